@@ -6,26 +6,111 @@
 #include <Arduino.h>
 #endif
 
+#include <math.h>
+#include <stdint.h>
+
 #include "Calendar.hpp"
 
-#define INT(value) (value >= 0 ? (long)(value) : (long)(value-1))
+// Days from March 1st of year -4800 to Julian day number 0 (years counted from March keep leap days last),
+// in Gregorian and Julian calendars
+#define GREGORIAN_DAYS_BEFORE_DAY_NUMBER_ZERO 32044L
+#define JULIAN_DAYS_BEFORE_DAY_NUMBER_ZERO    32082L
 
-JulianDay Calendar::julianDayForDate(float day, unsigned int month, unsigned int year )
+// Seconds per day
+#define SECONDS_PER_DAY 86400L
+
+// Days from civil (H. Hinnant), with years shifted by 12 eras to stay positive.
+// Divisions by constants become multiplications: no branch, so that loops vectorize.
+static inline int32_t julianDayNumberForCivil(int32_t day, int32_t month, int32_t year)
 {
-    if( month <= 2 )
-    {
-        year = year - 1;
-        month = month + 12;
-    }
+    int32_t january = (14-month)/12;                  // 1 for January and February
+    int32_t y       = year + 4800 - january;
+    int32_t m       = month + 12*january - 3;         // 0 for March
     
-    long A = INT(year/100.0);
-    long B = 2-A+INT(A/4);
+    int32_t era = y/400;
+    int32_t yoe = y - era*400;                        // Year of era [0,399]
+    int32_t doy = (153*m + 2)/5 + day - 1;            // Day of year from March [0,365]
+    int32_t doe = yoe*365 + yoe/4 - yoe/100 + doy;    // Day of era [0,146096]
     
-    JulianDay julianDay;
+    return era*146097 + doe - GREGORIAN_DAYS_BEFORE_DAY_NUMBER_ZERO;
+}
+
+// Civil from days (H. Hinnant), inverse of julianDayNumberForCivil.
+static inline void civilForJulianDayNumber(int32_t julianDayNumber, int32_t *day, int32_t *month, int32_t *year)
+{
+    int32_t z   = julianDayNumber + GREGORIAN_DAYS_BEFORE_DAY_NUMBER_ZERO;
+    int32_t era = z/146097;
+    int32_t doe = z - era*146097;
+    int32_t yoe = (doe - doe/1460 + doe/36524 - doe/146096)/365;
+    int32_t doy = doe - (365*yoe + yoe/4 - yoe/100);
+    int32_t mp  = (5*doy + 2)/153;                    // 0 for March
+    int32_t january = mp/10;                          // 1 for January and February
+    
+    *day   = doy - (153*mp + 2)/5 + 1;
+    *month = mp + 3 - 12*january;
+    *year  = era*400 + yoe - 4800 + january;
+}
+
+// Same from Julian calendar (4 years cycles).
+static inline void julianCalendarForJulianDayNumber(int32_t julianDayNumber, int32_t *day, int32_t *month, int32_t *year)
+{
+    int32_t z   = julianDayNumber + JULIAN_DAYS_BEFORE_DAY_NUMBER_ZERO;
+    int32_t c   = (4*z + 3)/1461;
+    int32_t doy = z - 1461*c/4;
+    int32_t mp  = (5*doy + 2)/153;
+    int32_t january = mp/10;
+    
+    *day   = doy - (153*mp + 2)/5 + 1;
+    *month = mp + 3 - 12*january;
+    *year  = c - 4800 + january;
+}
+
+long Calendar::julianDayNumberForDate(unsigned int day, unsigned int month, int year)
+{
+    return julianDayNumberForCivil(day, month, year);
+}
+
+void Calendar::dateForJulianDayNumber(long julianDayNumber, unsigned int *day, unsigned int *month, int *year)
+{
+    int32_t d, m, y;
+    civilForJulianDayNumber(julianDayNumber, &d, &m, &y);
     
-    julianDay.day  = INT(365.25*(year+4716)) + INT(30.6001*(month+1)) + (int)(day) + B - 1524.5;
+    *day   = d;
+    *month = m;
+    *year  = y;
+}
+
+void Calendar::julianDayNumbersForDates(const unsigned int *days, const unsigned int *months, const int *years, int count,
+                                        long *julianDayNumbers)
+{
+    for(int i=0; i<count; i++)
+    {
+        julianDayNumbers[i] = julianDayNumberForCivil(days[i], months[i], years[i]);
+    }
+}
+
+void Calendar::datesForJulianDayNumbers(const long *julianDayNumbers, int count,
+                                        unsigned int *days, unsigned int *months, int *years)
+{
+    for(int i=0; i<count; i++)
+    {
+        int32_t d, m, y;
+        civilForJulianDayNumber(julianDayNumbers[i], &d, &m, &y);
+        
+        days[i]   = d;
+        months[i] = m;
+        years[i]  = y;
+    }
+}
+
+JulianDay Calendar::julianDayForDate(float day, unsigned int month, unsigned int year )
+{
+    float wholeDay = floor(day);
     
-    julianDay.time = 0.5 + (day-(int)day);
+    // Midnight of date is half a day before noon
+    JulianDay julianDay;
+    julianDay.day  = julianDayNumberForCivil((int32_t)wholeDay, month, year) - 1;
+    julianDay.time = 0.5 + (day-wholeDay);
     
     // Adjust day and time if needed
     if( julianDay.time >= 1 )
@@ -38,10 +123,49 @@ JulianDay Calendar::julianDayForDate(float day, unsigned int month, unsigned int
     return julianDay;
 }
 
+JulianDay Calendar::julianDayForJulianDate(double julianDate)
+{
+    double wholeDay = floor(julianDate);
+    
+    JulianDay julianDay;
+    julianDay.day  = (long)wholeDay;
+    julianDay.time = (float)(julianDate-wholeDay);
+    
+    return julianDay;
+}
+
+JulianDay Calendar::julianDayForUnixTime(long long unixTime)
+{
+    // Seconds from noon of December 31st, 1969 (Julian day 2440587)
+    long long seconds = unixTime + SECONDS_PER_DAY/2;
+    long long days    = seconds/SECONDS_PER_DAY;
+    seconds -= days*SECONDS_PER_DAY;
+    
+    // Division rounds toward zero
+    if( seconds < 0 )
+    {
+        seconds += SECONDS_PER_DAY;
+        days    -= 1;
+    }
+    
+    JulianDay julianDay;
+    julianDay.day  = 2440587L + (long)days;
+    julianDay.time = (float)seconds/SECONDS_PER_DAY;
+    
+    return julianDay;
+}
+
 JulianDay Calendar::julianDayForDateAndTime(unsigned int day, unsigned int month, unsigned int year,
                                             unsigned int hour, unsigned int minute, unsigned int second)
 {
-    return julianDayForDate(day+ hour/24.0 + minute/1440.0 + second/86400.0,month,year);
+    // Whole seconds from noon before date, so that time keeps single precision of its own
+    long seconds = hour*3600L + minute*60L + second + SECONDS_PER_DAY/2;
+    
+    JulianDay julianDay;
+    julianDay.day  = julianDayNumberForCivil(day, month, year) - 1 + seconds/SECONDS_PER_DAY;
+    julianDay.time = (float)(seconds%SECONDS_PER_DAY)/SECONDS_PER_DAY;
+    
+    return julianDay;
 }
 
 
@@ -58,40 +182,20 @@ void Calendar::dateForJulianDay(JulianDay julianDay, float *day, unsigned int *m
         Z += 1;
     }
     
-    long A;
+    // Julian calendar before October 15th, 1582
+    int32_t d, m, y;
     if( Z<2299161 )
     {
-        A = Z;
+        julianCalendarForJulianDayNumber(Z, &d, &m, &y);
     }
     else
     {
-        long alpha = INT((Z-1867216.25)/36524.25);
-        A     = Z+1+alpha-INT(alpha/4);
+        civilForJulianDayNumber(Z, &d, &m, &y);
     }
     
-    long B = A + 1524;
-    long C = INT((B-122.1)/365.25);
-    long D = INT(365.25*C);
-    long E = INT((B-D)/30.6001);
-    
-    *day   = B-D-INT(30.6001*E)+F;
-    if( E<14)
-    {
-        *month = (unsigned)(E-1);
-    }
-    else
-    {
-        *month = (unsigned)(E-13);
-    }
-    
-    if( *month > 2 )
-    {
-        *year = (unsigned)(C-4716);
-    }
-    else
-    {
-        *year = (unsigned)(C-4715);
-    }
+    *day   = d+F;
+    *month = (unsigned)m;
+    *year  = (unsigned)y;
     
     return;
 }
@@ -99,20 +203,22 @@ void Calendar::dateForJulianDay(JulianDay julianDay, float *day, unsigned int *m
 void Calendar::dateAndTimeForJulianDay(JulianDay julianDay, unsigned int *day, unsigned int *month, unsigned int *year,
                                        unsigned int *hour, unsigned int *minute, unsigned int *second)
 {
-    // Calculate date with float value for day.
-    float floatingDay;
-    Calendar::dateForJulianDay(julianDay, &floatingDay, month, year);
+    // Seconds from midnight rounded once, so that 12:00:00 does not read 11:59:59
+    long seconds = (long)floor(julianDay.time*SECONDS_PER_DAY + 0.5) + SECONDS_PER_DAY/2;
+    long days    = seconds/SECONDS_PER_DAY;
+    seconds     -= days*SECONDS_PER_DAY;
     
-    // Store int value for day
-    *day = (int)floatingDay;
+    JulianDay midnight;
+    midnight.day  = julianDay.day + days - 1;
+    midnight.time = 0.5;
     
-    // Keep only decimal value
-    floatingDay -= *day;
+    float floatingDay;
+    Calendar::dateForJulianDay(midnight, &floatingDay, month, year);
     
-    // Calculate hour,minute,second
-    *hour   = floatingDay*24;
-    *minute = floatingDay*1440-*hour*60;
-    *second = floatingDay*86400-*hour*3600-*minute*60;
+    *day    = (unsigned int)floatingDay;
+    *hour   = seconds/3600;
+    *minute = seconds/60%60;
+    *second = seconds%60;
     
     return;
 }
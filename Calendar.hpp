@@ -24,8 +24,31 @@ class Calendar
 {
 public:
     
+    /*! Get Julian day number (noon of date, proleptic Gregorian calendar) for a date from year -4800.
+     *  Midnight of date is JulianDay {number-1, 0.5}. Integer arithmetic only, without branch. */
+    static long julianDayNumberForDate(unsigned int day, unsigned int month, int year);
+    
+    /*! Get date (proleptic Gregorian calendar) for a Julian day number from -32044 (year -4800).
+     *  Integer arithmetic only, without branch. */
+    static void dateForJulianDayNumber(long julianDayNumber, unsigned int *day, unsigned int *month, int *year);
+    
+    /*! Get Julian day numbers for count dates (see julianDayNumberForDate). */
+    static void julianDayNumbersForDates(const unsigned int *days, const unsigned int *months, const int *years, int count,
+                                         long *julianDayNumbers);
+    
+    /*! Get dates for count Julian day numbers (see dateForJulianDayNumber). */
+    static void datesForJulianDayNumbers(const long *julianDayNumbers, int count,
+                                         unsigned int *days, unsigned int *months, int *years);
+    
     static JulianDay julianDayForDate(float day, unsigned int month, unsigned int year);
     
+    /*! Split a Julian date (2451545.0 is January 1st, 2000 at 12h) in integer and floating parts.
+     *  Double precision is needed (on Arduino AVR, double is float and only resolves a quarter of day). */
+    static JulianDay julianDayForJulianDate(double julianDate);
+    
+    /*! Get Julian day for Unix time (seconds from January 1st, 1970 at 0h UTC), without float rounding of days. */
+    static JulianDay julianDayForUnixTime(long long unixTime);
+    
     static JulianDay julianDayForDateAndTime(unsigned int day, unsigned int month, unsigned int year,
                                              unsigned int hour, unsigned int minute, unsigned int second);
     
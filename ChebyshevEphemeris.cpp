@@ -0,0 +1,232 @@
+/*
+ * ChebyshevEphemeris.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+#include <math.h>
+#include <limits.h>
+
+#include "ChebyshevEphemeris.hpp"
+
+
+#ifndef PI
+#define PI 3.1415926535
+#endif
+
+// Limit range
+#define LIMIT_DEGREES_TO_360(value) value >= 0 ? (value-(long)(value/360)*360) : ((value-(long)(value/360)*360)+360)
+
+// Julian days per century (T unit)
+#define DAYS_PER_CENTURY 36525.0
+
+ChebyshevEphemeris::ChebyshevEphemeris(float segmentDays, int degree)
+{
+    if( degree > CHEBYSHEV_MAX_DEGREE )
+    {
+        degree = CHEBYSHEV_MAX_DEGREE;
+    }
+    
+    if( degree < 1 )
+    {
+        degree = 1;
+    }
+    
+    // Zero, negative or NaN length would divide by zero in segmentForPlanetAndT
+    if( !(segmentDays >= CHEBYSHEV_MIN_SEGMENT_DAYS) )
+    {
+        segmentDays = CHEBYSHEV_MIN_SEGMENT_DAYS;
+    }
+    
+    this->segmentDays = segmentDays;
+    this->degree      = degree;
+    
+    clear();
+}
+
+void ChebyshevEphemeris::clear()
+{
+    for(int planet=0; planet<CHEBYSHEV_PLANET_COUNT; planet++)
+    {
+        for(int slot=0; slot<CHEBYSHEV_SLOTS_PER_PLANET; slot++)
+        {
+            segments[planet][slot].index = LONG_MIN;
+        }
+    }
+}
+
+HeliocentricCoordinates ChebyshevEphemeris::heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T)
+{
+    float x;
+    const ChebyshevSegment *segment = segmentForPlanetAndT(planet, T, &x);
+    
+    if( segment == NULL )
+    {
+        // Not cached (Sun or unknown object): use series
+        return Ephemeris::heliocentricCoordinatesForPlanetAndT(planet, T);
+    }
+    
+    HeliocentricCoordinates coordinates;
+    
+    coordinates.lon    = evaluate(segment->lon, x);
+    coordinates.lon    = LIMIT_DEGREES_TO_360(coordinates.lon);
+    coordinates.lat    = evaluate(segment->lat, x);
+    coordinates.radius = evaluate(segment->radius, x);
+    
+    return coordinates;
+}
+
+HeliocentricCoordinates ChebyshevEphemeris::errorEstimateForPlanetAndT(SolarSystemObjectIndex planet, float T)
+{
+    float x;
+    const ChebyshevSegment *segment = segmentForPlanetAndT(planet, T, &x);
+    
+    if( segment == NULL )
+    {
+        // Direct series
+        HeliocentricCoordinates noError = {0,0,0};
+        return noError;
+    }
+    
+    return segment->maxError;
+}
+
+const ChebyshevSegment *ChebyshevEphemeris::segmentForPlanetAndT(SolarSystemObjectIndex planet, float T, float *x)
+{
+    if( planet <= Sun || planet >= CHEBYSHEV_PLANET_COUNT )
+    {
+        return NULL;
+    }
+    
+    float days  = T*DAYS_PER_CENTURY;
+    long  index = (long)floor(days/segmentDays);
+    
+    // Direct mapped slot (index may be negative before J2000)
+    int slot = (int)(index % CHEBYSHEV_SLOTS_PER_PLANET);
+    if( slot < 0 )
+    {
+        slot += CHEBYSHEV_SLOTS_PER_PLANET;
+    }
+    
+    ChebyshevSegment *segment = &segments[planet][slot];
+    if( segment->index != index )
+    {
+        // Lazy fit
+        fitSegment(segment, planet, index);
+    }
+    
+    // Normalized time inside segment
+    *x = 2*(days-index*segmentDays)/segmentDays - 1;
+    
+    return segment;
+}
+
+void ChebyshevEphemeris::fitSegment(ChebyshevSegment *segment, SolarSystemObjectIndex planet, long index)
+{
+    int   nodeCount = degree+1;
+    float startDays = index*segmentDays;
+    
+    HeliocentricCoordinates samples[CHEBYSHEV_MAX_DEGREE+1];
+    
+    // Sample series at Chebyshev nodes (ordered by decreasing time)
+    for(int node=0; node<nodeCount; node++)
+    {
+        float x    = cos(PI*(node+0.5)/nodeCount);
+        float days = startDays + (x+1)*segmentDays/2;
+        
+        samples[node] = Ephemeris::heliocentricCoordinatesForPlanetAndT(planet, days/DAYS_PER_CENTURY);
+        
+        // Unwrap longitude so that it is continuous over the segment
+        if( node > 0 )
+        {
+            float delta = samples[node].lon - samples[node-1].lon;
+            if( delta > 180 )
+            {
+                samples[node].lon -= 360*(long)((delta+180)/360);
+            }
+            else if( delta < -180 )
+            {
+                samples[node].lon += 360*(long)((-delta+180)/360);
+            }
+        }
+    }
+    
+    // Discrete Chebyshev transform
+    for(int j=0; j<nodeCount; j++)
+    {
+        float lon=0, lat=0, radius=0;
+        
+        for(int node=0; node<nodeCount; node++)
+        {
+            float Tj = cos(PI*j*(node+0.5)/nodeCount);
+            
+            lon    += samples[node].lon*Tj;
+            lat    += samples[node].lat*Tj;
+            radius += samples[node].radius*Tj;
+        }
+        
+        // First coefficient is halved once for all (see evaluate)
+        float factor = (j == 0 ? 1.0 : 2.0)/nodeCount;
+        
+        segment->lon[j]    = lon*factor;
+        segment->lat[j]    = lat*factor;
+        segment->radius[j] = radius*factor;
+    }
+    
+    segment->index = index;
+    
+    // Measure error against series between nodes
+    segment->maxError.lon    = 0;
+    segment->maxError.lat    = 0;
+    segment->maxError.radius = 0;
+    
+    for(int extremum=1; extremum<nodeCount; extremum++)
+    {
+        float x    = cos(PI*extremum/nodeCount);
+        float days = startDays + (x+1)*segmentDays/2;
+        
+        HeliocentricCoordinates direct = Ephemeris::heliocentricCoordinatesForPlanetAndT(planet, days/DAYS_PER_CENTURY);
+        
+        float lonError = evaluate(segment->lon, x) - direct.lon;
+        lonError = lonError - 360*floor(lonError/360+0.5);
+        
+        float latError    = fabs(evaluate(segment->lat, x) - direct.lat);
+        float radiusError = fabs(evaluate(segment->radius, x) - direct.radius);
+        
+        segment->maxError.lon    = fmax(segment->maxError.lon,    fabs(lonError));
+        segment->maxError.lat    = fmax(segment->maxError.lat,    latError);
+        segment->maxError.radius = fmax(segment->maxError.radius, radiusError);
+    }
+}
+
+float ChebyshevEphemeris::evaluate(const float *coefficients, float x) const
+{
+    float b1 = 0;
+    float b2 = 0;
+    
+    for(int j=degree; j>0; j--)
+    {
+        float b0 = 2*x*b1 - b2 + coefficients[j];
+        b2 = b1;
+        b1 = b0;
+    }
+    
+    return x*b1 - b2 + coefficients[0];
+}
@@ -0,0 +1,115 @@
+/*
+ * ChebyshevEphemeris.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ChebyshevEphemeris_h
+#define ChebyshevEphemeris_h
+
+#include "Ephemeris.hpp"
+
+// Highest polynomial degree of a segment.
+#ifndef CHEBYSHEV_MAX_DEGREE
+#define CHEBYSHEV_MAX_DEGREE 16
+#endif
+
+// Number of segments kept per planet (direct mapped on segment index).
+#ifndef CHEBYSHEV_SLOTS_PER_PLANET
+#define CHEBYSHEV_SLOTS_PER_PLANET 8
+#endif
+
+// Default segment length and degree (see error estimate below).
+#define CHEBYSHEV_DEFAULT_SEGMENT_DAYS 8
+#define CHEBYSHEV_DEFAULT_DEGREE       10
+
+// Shortest segment length (T only resolves about a minute).
+#define CHEBYSHEV_MIN_SEGMENT_DAYS (1.0/24)
+
+// Planets served by heliocentricCoordinatesForPlanetAndT.
+#define CHEBYSHEV_PLANET_COUNT (Neptune+1)
+
+/*! This structure describes Chebyshev polynomials of one planet over one segment. */
+struct ChebyshevSegment
+{
+    /*! Segment index (segment number since J2000), LONG_MIN when not built. */
+    long index;
+    
+    /*! Coefficients for longitude (unwrapped), latitude and radius. */
+    float lon[CHEBYSHEV_MAX_DEGREE+1];
+    float lat[CHEBYSHEV_MAX_DEGREE+1];
+    float radius[CHEBYSHEV_MAX_DEGREE+1];
+    
+    /*! Largest difference with direct VSOP87 series at sampled extrema when fitting (estimate, not a bound). */
+    HeliocentricCoordinates maxError;
+};
+
+/*!
+ * This class caches heliocentric coordinates as Chebyshev polynomials over fixed-length segments.
+ *
+ * Segments are aligned on J2000 and fitted the first time they are used, by interpolation of
+ * Ephemeris::heliocentricCoordinatesForPlanetAndT at degree+1 Chebyshev nodes. A lookup is then
+ * one Clenshaw evaluation per coordinate.
+ *
+ * Error estimate: when a segment is fitted the polynomials are compared with the direct series at the
+ * degree-1 extrema of T(degree+1), where interpolation error peaks, and the largest difference is
+ * kept (see errorEstimateForPlanetAndT). Sampling misses series noise between extrema, so the estimate
+ * can be up to 25% below the dense maximum. With default settings (8 days, degree 10) over 1992-2008
+ * the error stays below 5e-3 degree for Mercury, 2e-3 degree for Venus and Earth, 7e-4 degree
+ * for Mars, 2e-4 degree for outer planets and 1.5e-5 AU for radius. These values are the single
+ * precision noise of the direct series (T is quantized to about 50 seconds), the polynomial error
+ * is lower.
+ */
+class ChebyshevEphemeris
+{
+public:
+    
+    /*! Create an empty cache. Degree is clamped to [1,CHEBYSHEV_MAX_DEGREE], segment length is at least CHEBYSHEV_MIN_SEGMENT_DAYS. */
+    ChebyshevEphemeris(float segmentDays = CHEBYSHEV_DEFAULT_SEGMENT_DAYS, int degree = CHEBYSHEV_DEFAULT_DEGREE);
+    
+    /*! Compute heliocentric coordinates for T in Julian centuries from J2000 (fit segment if needed). */
+    HeliocentricCoordinates heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T);
+    
+    /*! Estimated error against direct series for the segment containing T (fit segment if needed).
+     *  Differences are sampled at extrema only: dense maximum can be larger (see class description). */
+    HeliocentricCoordinates errorEstimateForPlanetAndT(SolarSystemObjectIndex planet, float T);
+    
+    /*! Forget every fitted segment. */
+    void clear();
+    
+private:
+    
+    /*! Get segment containing T and normalized time in [-1,1] inside it. */
+    const ChebyshevSegment *segmentForPlanetAndT(SolarSystemObjectIndex planet, float T, float *x);
+    
+    /*! Fit segment for a planet. */
+    void fitSegment(ChebyshevSegment *segment, SolarSystemObjectIndex planet, long index);
+    
+    /*! Evaluate Chebyshev polynomials with Clenshaw recurrence. */
+    float evaluate(const float *coefficients, float x) const;
+    
+    /*! Segment length in days. */
+    float segmentDays;
+    
+    /*! Polynomial degree. */
+    int degree;
+    
+    /*! Fitted segments. */
+    ChebyshevSegment segments[CHEBYSHEV_PLANET_COUNT][CHEBYSHEV_SLOTS_PER_PLANET];
+};
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * ELP2000Moon.h
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ELP2000Moon_h
+#define ELP2000Moon_h
+
+#ifndef CONST
+#if ARDUINO
+#define CONST const PROGMEM
+#else
+#define CONST const
+#endif
+#endif
+
+// Number of periodic terms of each table
+#define MOON_TERM_COUNT 60
+
+/*! This structure describes one periodic term of the Moon (Meeus chapter 47, truncated ELP-2000/82).
+ *  Argument is D*D + M*M + Mm*M' + F*F, terms with M are multiplied by E^|M|. */
+struct MoonTerm
+{
+    /*! Multiples of mean elongation of the Moon, mean anomaly of the Sun, mean anomaly of the Moon and
+     *  argument of latitude of the Moon. */
+    signed char D;
+    signed char M;
+    signed char Mm;
+    signed char F;
+    
+    /*! Sine coefficient (longitude or latitude, 0.000001 degree) and cosine coefficient (distance, 0.001 km). */
+    long sine;
+    long cosine;
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Periodic terms for longitude and distance of the Moon (Meeus table 47.A).
+//
+////////////////////////////////////////////////////////////
+
+CONST MoonTerm MoonLongitudeDistanceTerms[MOON_TERM_COUNT] =
+{
+    { 0,  0,  1,  0,  6288774, -20905355},
+    { 2,  0, -1,  0,  1274027,  -3699111},
+    { 2,  0,  0,  0,   658314,  -2955968},
+    { 0,  0,  2,  0,   213618,   -569925},
+    { 0,  1,  0,  0,  -185116,     48888},
+    { 0,  0,  0,  2,  -114332,     -3149},
+    { 2,  0, -2,  0,    58793,    246158},
+    { 2, -1, -1,  0,    57066,   -152138},
+    { 2,  0,  1,  0,    53322,   -170733},
+    { 2, -1,  0,  0,    45758,   -204586},
+    { 0,  1, -1,  0,   -40923,   -129620},
+    { 1,  0,  0,  0,   -34720,    108743},
+    { 0,  1,  1,  0,   -30383,    104755},
+    { 2,  0,  0, -2,    15327,     10321},
+    { 0,  0,  1,  2,   -12528,         0},
+    { 0,  0,  1, -2,    10980,     79661},
+    { 4,  0, -1,  0,    10675,    -34782},
+    { 0,  0,  3,  0,    10034,    -23210},
+    { 4,  0, -2,  0,     8548,    -21636},
+    { 2,  1, -1,  0,    -7888,     24208},
+    { 2,  1,  0,  0,    -6766,     30824},
+    { 1,  0, -1,  0,    -5163,     -8379},
+    { 1,  1,  0,  0,     4987,    -16675},
+    { 2, -1,  1,  0,     4036,    -12831},
+    { 2,  0,  2,  0,     3994,    -10445},
+    { 4,  0,  0,  0,     3861,    -11650},
+    { 2,  0, -3,  0,     3665,     14403},
+    { 0,  1, -2,  0,    -2689,     -7003},
+    { 2,  0, -1,  2,    -2602,         0},
+    { 2, -1, -2,  0,     2390,     10056},
+    { 1,  0,  1,  0,    -2348,      6322},
+    { 2, -2,  0,  0,     2236,     -9884},
+    { 0,  1,  2,  0,    -2120,      5751},
+    { 0,  2,  0,  0,    -2069,         0},
+    { 2, -2, -1,  0,     2048,     -4950},
+    { 2,  0,  1, -2,    -1773,      4130},
+    { 2,  0,  0,  2,    -1595,         0},
+    { 4, -1, -1,  0,     1215,     -3958},
+    { 0,  0,  2,  2,    -1110,         0},
+    { 3,  0, -1,  0,     -892,      3258},
+    { 2,  1,  1,  0,     -810,      2616},
+    { 4, -1, -2,  0,      759,     -1897},
+    { 0,  2, -1,  0,     -713,     -2117},
+    { 2,  2, -1,  0,     -700,      2354},
+    { 2,  1, -2,  0,      691,         0},
+    { 2, -1,  0, -2,      596,         0},
+    { 4,  0,  1,  0,      549,     -1423},
+    { 0,  0,  4,  0,      537,     -1117},
+    { 4, -1,  0,  0,      520,     -1571},
+    { 1,  0, -2,  0,     -487,     -1739},
+    { 2,  1,  0, -2,     -399,         0},
+    { 0,  0,  2, -2,     -381,     -4421},
+    { 1,  1,  1,  0,      351,         0},
+    { 3,  0, -2,  0,     -340,         0},
+    { 4,  0, -3,  0,      330,         0},
+    { 2, -1,  2,  0,      327,         0},
+    { 0,  2,  1,  0,     -323,      1165},
+    { 1,  1, -1,  0,      299,         0},
+    { 2,  0,  3,  0,      294,         0},
+    { 2,  0, -1, -2,        0,      8752}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Periodic terms for latitude of the Moon (Meeus table 47.B).
+//
+////////////////////////////////////////////////////////////
+
+CONST MoonTerm MoonLatitudeTerms[MOON_TERM_COUNT] =
+{
+    { 0,  0,  0,  1,  5128122,         0},
+    { 0,  0,  1,  1,   280602,         0},
+    { 0,  0,  1, -1,   277693,         0},
+    { 2,  0,  0, -1,   173237,         0},
+    { 2,  0, -1,  1,    55413,         0},
+    { 2,  0, -1, -1,    46271,         0},
+    { 2,  0,  0,  1,    32573,         0},
+    { 0,  0,  2,  1,    17198,         0},
+    { 2,  0,  1, -1,     9266,         0},
+    { 0,  0,  2, -1,     8822,         0},
+    { 2, -1,  0, -1,     8216,         0},
+    { 2,  0, -2, -1,     4324,         0},
+    { 2,  0,  1,  1,     4200,         0},
+    { 2,  1,  0, -1,    -3359,         0},
+    { 2, -1, -1,  1,     2463,         0},
+    { 2, -1,  0,  1,     2211,         0},
+    { 2, -1, -1, -1,     2065,         0},
+    { 0,  1, -1, -1,    -1870,         0},
+    { 4,  0, -1, -1,     1828,         0},
+    { 0,  1,  0,  1,    -1794,         0},
+    { 0,  0,  0,  3,    -1749,         0},
+    { 0,  1, -1,  1,    -1565,         0},
+    { 1,  0,  0,  1,    -1491,         0},
+    { 0,  1,  1,  1,    -1475,         0},
+    { 0,  1,  1, -1,    -1410,         0},
+    { 0,  1,  0, -1,    -1344,         0},
+    { 1,  0,  0, -1,    -1335,         0},
+    { 0,  0,  3,  1,     1107,         0},
+    { 4,  0,  0, -1,     1021,         0},
+    { 4,  0, -1,  1,      833,         0},
+    { 0,  0,  1, -3,      777,         0},
+    { 4,  0, -2,  1,      671,         0},
+    { 2,  0,  0, -3,      607,         0},
+    { 2,  0,  2, -1,      596,         0},
+    { 2, -1,  1, -1,      491,         0},
+    { 2,  0, -2,  1,     -451,         0},
+    { 0,  0,  3, -1,      439,         0},
+    { 2,  0,  2,  1,      422,         0},
+    { 2,  0, -3, -1,      421,         0},
+    { 2,  1, -1,  1,     -366,         0},
+    { 2,  1,  0,  1,     -351,         0},
+    { 4,  0,  0,  1,      331,         0},
+    { 2, -1,  1,  1,      315,         0},
+    { 2, -2,  0, -1,      302,         0},
+    { 0,  0,  1,  3,     -283,         0},
+    { 2,  1,  1, -1,     -229,         0},
+    { 1,  1,  0, -1,      223,         0},
+    { 1,  1,  0,  1,      223,         0},
+    { 0,  1, -2, -1,     -220,         0},
+    { 2,  1, -1, -1,     -220,         0},
+    { 1,  0,  1,  1,     -185,         0},
+    { 2, -1, -2, -1,      181,         0},
+    { 0,  1,  2,  1,     -177,         0},
+    { 4,  0, -2, -1,      176,         0},
+    { 4, -1, -1, -1,      166,         0},
+    { 1,  0,  1, -1,     -164,         0},
+    { 4,  0,  1, -1,      132,         0},
+    { 1,  0, -1, -1,     -119,         0},
+    { 4, -1,  0, -1,      115,         0},
+    { 2, -2,  0,  1,      107,         0}
+};
+
+#endif
@@ -22,19 +22,41 @@
 #include <Arduino.h>
 #endif
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
 
 #include "Ephemeris.hpp"
+#include "VSOP87SoA.hpp"
+#include "FastMath.hpp"
+#include "IAU1980Nutation.h"
+#include "ELP2000Moon.h"
+#include "VSOP87FixedPoint.hpp"
 
 
 #ifndef PI
 #define PI 3.1415926535
 #endif
 
-// Trigonometry using degrees
-#define SIND(value)   sin((value*PI)/180)
-#define COSD(value)   cos((value*PI)/180)
-#define TAND(value)   tan((value*PI)/180)
+// Single precision polynomial trigonometry (see FastMath.hpp), 0 for libm
+#ifndef EPHEMERIS_FAST_TRIG
+#define EPHEMERIS_FAST_TRIG 1
+#endif
+
+// Trigonometry using degrees and radians
+#if EPHEMERIS_FAST_TRIG
+#define SIND(value)   fastSinDegrees<float,int>((float)(value))
+#define COSD(value)   fastCosDegrees<float,int>((float)(value))
+#define SINCOSD(value,sine,cosine) fastSinCosDegrees<float,int>((float)(value),sine,cosine)
+#define COSR(value)   fastCos<float,int>((float)(value))
+#define SINCOSR(value,sine,cosine) fastSinCos<float,int>((float)(value),sine,cosine)
+#else
+#define SIND(value)   sin(((value)*PI)/180)
+#define COSD(value)   cos(((value)*PI)/180)
+#define SINCOSD(value,sine,cosine) (*(sine) = SIND(value), *(cosine) = COSD(value))
+#define COSR(value)   cos(value)
+#define SINCOSR(value,sine,cosine) (*(sine) = sin(value), *(cosine) = cos(value))
+#endif
+
 #define ASIND(value) asin((value*PI)/180)
 #define ACOSD(value) acos((value*PI)/180)
 #define ATAND(value) atan((value*PI)/180)
@@ -58,13 +80,115 @@
 #define HOURS_MINUTES_SECONDS_TO_SECONDS(hour,min,sec) ((float)hour*3600+(float)min*60+(float)sec)
 #define HOURS_MINUTES_SECONDS_TO_DECIMAL_HOURS(hour,min,sec) ((float)hour+(float)min/60+(float)sec/3600)
 
+// Julian days per thousand of Julian years (VSOP87 time unit)
+#define DAYS_PER_MILLENNIUM 365250.0
+
+// Kilometers per astronomical unit and equatorial radius of Earth in kilometers
+#define KILOMETERS_PER_AU       149597870.7
+#define EARTH_EQUATORIAL_RADIUS 6378.14
+
 // Convert seconds
 #define SECONDS_TO_DECIMAL_DEGREES(value) ((float)value/3600)
 #define SECONDS_TO_DECIMAL_HOURS(value) ((float)value/3600)
 
-// Observer's coordinates on Earth
-static float latitudeOnEarth  = NAN;
-static float longitudeOnEarth = NAN;
+// Nutation from the 106 terms of IAU 1980 theory (0.001 arc second), 0 for the 13 largest terms (0.5 arc second)
+#ifndef EPHEMERIS_NUTATION_IAU1980
+#define EPHEMERIS_NUTATION_IAU1980 1
+#endif
+
+// Maximum number of light time iterations (converges in 2 or 3 in single precision)
+#ifndef EPHEMERIS_LIGHT_TIME_ITERATIONS
+#define EPHEMERIS_LIGHT_TIME_ITERATIONS 5
+#endif
+
+// Number of steps of velocity light time correction (error shrinks by v/c, about 1e-4, at each step)
+#ifndef EPHEMERIS_LIGHT_TIME_VELOCITY_STEPS
+#define EPHEMERIS_LIGHT_TIME_VELOCITY_STEPS 2
+#endif
+
+// Observer, settings and caches of functions without context
+static EphemerisContext defaultEphemerisContext;
+
+// Truncation error bounds hold for |T| below this value (thousands of Julian years from J2000: 1800-2200)
+#ifndef VSOP87_TRUNCATION_TAU
+#define VSOP87_TRUNCATION_TAU 0.2
+#endif
+
+// VSOP87 tables of each planet, known at compile time (flash memory on Arduino)
+#define VSOP87_SERIES(table) {table, sizeof(table)/sizeof(VSOP87Coefficient)}
+#define VSOP87_NO_SERIES      {NULL, 0}
+
+#if ARDUINO
+#define VSOP87_DESCRIPTOR constexpr PROGMEM
+#else
+#define VSOP87_DESCRIPTOR constexpr
+#endif
+
+static VSOP87_DESCRIPTOR VSOP87PlanetSeries vsop87PlanetSeries[] =
+{
+    // Sun
+    {{
+        {VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES},
+        {VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES},
+        {VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES}
+    }},
+    
+    // Mercury
+    {{
+        {VSOP87_SERIES(L0MercuryCoefficients), VSOP87_SERIES(L1MercuryCoefficients), VSOP87_SERIES(L2MercuryCoefficients), VSOP87_SERIES(L3MercuryCoefficients), VSOP87_SERIES(L4MercuryCoefficients), VSOP87_SERIES(L5MercuryCoefficients)},
+        {VSOP87_SERIES(B0MercuryCoefficients), VSOP87_SERIES(B1MercuryCoefficients), VSOP87_SERIES(B2MercuryCoefficients), VSOP87_SERIES(B3MercuryCoefficients), VSOP87_SERIES(B4MercuryCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0MercuryCoefficients), VSOP87_SERIES(R1MercuryCoefficients), VSOP87_SERIES(R2MercuryCoefficients), VSOP87_SERIES(R3MercuryCoefficients), VSOP87_NO_SERIES, VSOP87_NO_SERIES}
+    }},
+    
+    // Venus
+    {{
+        {VSOP87_SERIES(L0VenusCoefficients), VSOP87_SERIES(L1VenusCoefficients), VSOP87_SERIES(L2VenusCoefficients), VSOP87_SERIES(L3VenusCoefficients), VSOP87_SERIES(L4VenusCoefficients), VSOP87_SERIES(L5VenusCoefficients)},
+        {VSOP87_SERIES(B0VenusCoefficients), VSOP87_SERIES(B1VenusCoefficients), VSOP87_SERIES(B2VenusCoefficients), VSOP87_SERIES(B3VenusCoefficients), VSOP87_SERIES(B4VenusCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0VenusCoefficients), VSOP87_SERIES(R1VenusCoefficients), VSOP87_SERIES(R2VenusCoefficients), VSOP87_SERIES(R3VenusCoefficients), VSOP87_SERIES(R4VenusCoefficients), VSOP87_NO_SERIES}
+    }},
+    
+    // Earth
+    {{
+        {VSOP87_SERIES(L0EarthCoefficients), VSOP87_SERIES(L1EarthCoefficients), VSOP87_SERIES(L2EarthCoefficients), VSOP87_SERIES(L3EarthCoefficients), VSOP87_SERIES(L4EarthCoefficients), VSOP87_SERIES(L5EarthCoefficients)},
+        {VSOP87_SERIES(B0EarthCoefficients), VSOP87_SERIES(B1EarthCoefficients), VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES, VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0EarthCoefficients), VSOP87_SERIES(R1EarthCoefficients), VSOP87_SERIES(R2EarthCoefficients), VSOP87_SERIES(R3EarthCoefficients), VSOP87_NO_SERIES, VSOP87_NO_SERIES}
+    }},
+    
+    // Mars
+    {{
+        {VSOP87_SERIES(L0MarsCoefficients), VSOP87_SERIES(L1MarsCoefficients), VSOP87_SERIES(L2MarsCoefficients), VSOP87_SERIES(L3MarsCoefficients), VSOP87_SERIES(L4MarsCoefficients), VSOP87_SERIES(L5MarsCoefficients)},
+        {VSOP87_SERIES(B0MarsCoefficients), VSOP87_SERIES(B1MarsCoefficients), VSOP87_SERIES(B2MarsCoefficients), VSOP87_SERIES(B3MarsCoefficients), VSOP87_SERIES(B4MarsCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0MarsCoefficients), VSOP87_SERIES(R1MarsCoefficients), VSOP87_SERIES(R2MarsCoefficients), VSOP87_SERIES(R3MarsCoefficients), VSOP87_SERIES(R4MarsCoefficients), VSOP87_NO_SERIES}
+    }},
+    
+    // Jupiter
+    {{
+        {VSOP87_SERIES(L0JupiterCoefficients), VSOP87_SERIES(L1JupiterCoefficients), VSOP87_SERIES(L2JupiterCoefficients), VSOP87_SERIES(L3JupiterCoefficients), VSOP87_SERIES(L4JupiterCoefficients), VSOP87_SERIES(L5JupiterCoefficients)},
+        {VSOP87_SERIES(B0JupiterCoefficients), VSOP87_SERIES(B1JupiterCoefficients), VSOP87_SERIES(B2JupiterCoefficients), VSOP87_SERIES(B3JupiterCoefficients), VSOP87_SERIES(B4JupiterCoefficients), VSOP87_SERIES(B5JupiterCoefficients)},
+        {VSOP87_SERIES(R0JupiterCoefficients), VSOP87_SERIES(R1JupiterCoefficients), VSOP87_SERIES(R2JupiterCoefficients), VSOP87_SERIES(R3JupiterCoefficients), VSOP87_SERIES(R4JupiterCoefficients), VSOP87_SERIES(R5JupiterCoefficients)}
+    }},
+    
+    // Saturn
+    {{
+        {VSOP87_SERIES(L0SaturnCoefficients), VSOP87_SERIES(L1SaturnCoefficients), VSOP87_SERIES(L2SaturnCoefficients), VSOP87_SERIES(L3SaturnCoefficients), VSOP87_SERIES(L4SaturnCoefficients), VSOP87_SERIES(L5SaturnCoefficients)},
+        {VSOP87_SERIES(B0SaturnCoefficients), VSOP87_SERIES(B1SaturnCoefficients), VSOP87_SERIES(B2SaturnCoefficients), VSOP87_SERIES(B3SaturnCoefficients), VSOP87_SERIES(B4SaturnCoefficients), VSOP87_SERIES(B5SaturnCoefficients)},
+        {VSOP87_SERIES(R0SaturnCoefficients), VSOP87_SERIES(R1SaturnCoefficients), VSOP87_SERIES(R2SaturnCoefficients), VSOP87_SERIES(R3SaturnCoefficients), VSOP87_SERIES(R4SaturnCoefficients), VSOP87_SERIES(R5SaturnCoefficients)}
+    }},
+    
+    // Uranus
+    {{
+        {VSOP87_SERIES(L0UranusCoefficients), VSOP87_SERIES(L1UranusCoefficients), VSOP87_SERIES(L2UranusCoefficients), VSOP87_SERIES(L3UranusCoefficients), VSOP87_SERIES(L4UranusCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(B0UranusCoefficients), VSOP87_SERIES(B1UranusCoefficients), VSOP87_SERIES(B2UranusCoefficients), VSOP87_SERIES(B3UranusCoefficients), VSOP87_SERIES(B4UranusCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0UranusCoefficients), VSOP87_SERIES(R1UranusCoefficients), VSOP87_SERIES(R2UranusCoefficients), VSOP87_SERIES(R3UranusCoefficients), VSOP87_SERIES(R4UranusCoefficients), VSOP87_NO_SERIES}
+    }},
+    
+    // Neptune
+    {{
+        {VSOP87_SERIES(L0NeptuneCoefficients), VSOP87_SERIES(L1NeptuneCoefficients), VSOP87_SERIES(L2NeptuneCoefficients), VSOP87_SERIES(L3NeptuneCoefficients), VSOP87_SERIES(L4NeptuneCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(B0NeptuneCoefficients), VSOP87_SERIES(B1NeptuneCoefficients), VSOP87_SERIES(B2NeptuneCoefficients), VSOP87_SERIES(B3NeptuneCoefficients), VSOP87_SERIES(B4NeptuneCoefficients), VSOP87_NO_SERIES},
+        {VSOP87_SERIES(R0NeptuneCoefficients), VSOP87_SERIES(R1NeptuneCoefficients), VSOP87_SERIES(R2NeptuneCoefficients), VSOP87_SERIES(R3NeptuneCoefficients), VSOP87_NO_SERIES, VSOP87_NO_SERIES}
+    }}
+};
 
 void Ephemeris::floatingHoursToHoursMinutesSeconds(float floatingHours, int *hours, int *minutes, float *seconds)
 {
@@ -141,6 +265,107 @@ float Ephemeris::apparentSideralTime(unsigned int day,  unsigned int month,  uns
     return apparentSideralTime;
 }
 
+#if EPHEMERIS_NUTATION_IAU1980
+float Ephemeris::obliquityAndNutationForT(float T, float *deltaObliquity, float *deltaNutation)
+{
+    float TSquared = T*T;
+    float TCubed   = TSquared*T;
+    
+    // Fundamental arguments: D, M, M', F and omega (Chapter 22)
+    float D     = 297.85036 + T*445267.111480 - TSquared*0.0019142 + TCubed/189474;
+    float M     = 357.52772 + T*35999.050340  - TSquared*0.0001603 - TCubed/300000;
+    float M1    = 134.96298 + T*477198.867398 + TSquared*0.0086972 + TCubed/56250;
+    float F     = 93.27191  + T*483202.017538 - TSquared*0.0036825 + TCubed/327270;
+    float omega = 125.04452 - T*1934.136261   + TSquared*0.0020708 + TCubed/450000;
+    
+    float arguments[NUTATION_ARGUMENT_COUNT] = {D, M, M1, F, omega};
+    
+    // Sine and cosine of multiples -4..4 of each argument: one sincos per argument, then angle addition
+    float sines[NUTATION_ARGUMENT_COUNT][2*NUTATION_MAX_MULTIPLE+1];
+    float cosines[NUTATION_ARGUMENT_COUNT][2*NUTATION_MAX_MULTIPLE+1];
+    for(int argument=0; argument<NUTATION_ARGUMENT_COUNT; argument++)
+    {
+        float *sine   = sines[argument]+NUTATION_MAX_MULTIPLE;
+        float *cosine = cosines[argument]+NUTATION_MAX_MULTIPLE;
+        
+        float angle = arguments[argument];
+        angle = LIMIT_DEGREES_TO_360(angle);
+        
+        sine[0]   = 0;
+        cosine[0] = 1;
+        SINCOSD(angle, &sine[1], &cosine[1]);
+        
+        for(int multiple=2; multiple<=NUTATION_MAX_MULTIPLE; multiple++)
+        {
+            sine[multiple]   = sine[multiple-1]*cosine[1] + cosine[multiple-1]*sine[1];
+            cosine[multiple] = cosine[multiple-1]*cosine[1] - sine[multiple-1]*sine[1];
+        }
+        
+        for(int multiple=1; multiple<=NUTATION_MAX_MULTIPLE; multiple++)
+        {
+            sine[-multiple]   = -sine[multiple];
+            cosine[-multiple] =  cosine[multiple];
+        }
+    }
+    
+    // Delta Phi and Delta Eps (0.0001 arc second)
+    float dNutation  = 0;
+    float dObliquity = 0;
+    for(unsigned int numTerm=0; numTerm<sizeof(IAU1980NutationTerms)/sizeof(NutationTerm); numTerm++)
+    {
+        NutationTerm term;
+        
+#if ARDUINO
+        memcpy_P(&term, &IAU1980NutationTerms[numTerm], sizeof(NutationTerm));
+#else
+        term = IAU1980NutationTerms[numTerm];
+#endif
+        
+        const signed char multiples[NUTATION_ARGUMENT_COUNT] = {term.D, term.M, term.Mm, term.F, term.omega};
+        
+        // Angle addition of every argument used by the term (2.8 on average)
+        float sine   = sines[0][NUTATION_MAX_MULTIPLE+multiples[0]];
+        float cosine = cosines[0][NUTATION_MAX_MULTIPLE+multiples[0]];
+        for(int argument=1; argument<NUTATION_ARGUMENT_COUNT; argument++)
+        {
+            if( multiples[argument] == 0 )
+            {
+                continue;
+            }
+            
+            float argumentSine   = sines[argument][NUTATION_MAX_MULTIPLE+multiples[argument]];
+            float argumentCosine = cosines[argument][NUTATION_MAX_MULTIPLE+multiples[argument]];
+            
+            float newSine = sine*argumentCosine + cosine*argumentSine;
+            cosine        = cosine*argumentCosine - sine*argumentSine;
+            sine          = newSine;
+        }
+        
+        dNutation  += (term.longitude + term.longitudeRate*T)*sine;
+        dObliquity += (term.obliquity + term.obliquityRate*T)*cosine;
+    }
+    
+    dNutation  /= 10000;
+    dObliquity /= 10000;
+    
+    if( deltaNutation )
+    {
+        *deltaNutation = dNutation;
+    }
+    
+    if( deltaObliquity )
+    {
+        *deltaObliquity = dObliquity;
+    }
+    
+    float eps0 = DEGREES_MINUTES_SECONDES_TO_SECONDS(23,26,21.448)-T*46.8150-TSquared*0.00059+TCubed*0.001813;
+    
+    float obliquity = eps0 + dObliquity;
+    obliquity = SECONDS_TO_DECIMAL_DEGREES(obliquity);
+    
+    return obliquity;
+}
+#else
 float Ephemeris::obliquityAndNutationForT(float T, float *deltaObliquity, float *deltaNutation)
 {
     float TSquared = T*T;
@@ -206,30 +431,20 @@ float Ephemeris::obliquityAndNutationForT(float T, float *deltaObliquity, float
     
     return obliquity;
 }
+#endif
 
-EquatorialCoordinates  Ephemeris::equatorialCoordinatesForSunAtJD(JulianDay jd, float *distance, GeocentricCoordinates *gCoordinates)
+EquatorialCoordinates  Ephemeris::equatorialCoordinatesForSunAtEpoch(const EphemerisEpoch *epoch, float *distance, GeocentricCoordinates *gCoordinates)
 {
     EquatorialCoordinates sunCoordinates;
     
-    float T        = (jd.day-2451545.0+jd.time)/36525;
+    float T        = epoch->T;
     float TSquared = T*T;
     
-    float L0 = 280.46646 + T*36000.76983 + TSquared*0.0003032;
-    L0 = LIMIT_DEGREES_TO_360(L0);
-    
-    float M = 357.52911 + T*35999.05029  - TSquared*0.0001537;
-    M = LIMIT_DEGREES_TO_360(M);
-    
     float e = 0.016708634 - T*0.000042037 - TSquared*0.0000001267;
     
-    float C =
-    +(1.914602 - T*0.004817 - TSquared*0.000014) * SIND(M)
-    +(0.019993 - T*0.000101                    ) * SIND(2*M)
-    + 0.000289                                   * SIND(3*M);
-    
-    float O = L0 + C;
+    float O = epoch->sunLongitude;
     
-    float v = M  + C;
+    float v = epoch->sunAnomaly;
     
     // Improved precision for O according to page 65
     {
@@ -265,12 +480,12 @@ EquatorialCoordinates  Ephemeris::equatorialCoordinatesForSunAtJD(JulianDay jd,
     
     float lambda = O - 0.00569 - 0.00478 * SIND(omega);
     
-    float eps = obliquityAndNutationForT(T, NULL, NULL);
+    float eps = epoch->obliquity;
     
     eps += 0.00256*COSD(omega);
     
     // Alpha   (Hour=Deg/15.0)
-    sunCoordinates.ra = atan(COSD(eps)*TAND(lambda))*12/PI;
+    sunCoordinates.ra = atan2(COSD(eps)*SIND(lambda), COSD(lambda))*12/PI;
     sunCoordinates.ra = LIMIT_HOURS_TO_24(sunCoordinates.ra);
     
     // Delta
@@ -279,6 +494,112 @@ EquatorialCoordinates  Ephemeris::equatorialCoordinatesForSunAtJD(JulianDay jd,
     return sunCoordinates;
 }
 
+GeocentricCoordinates Ephemeris::geocentricCoordinatesForMoon(JulianDay jd, float *distance)
+{
+    // Days from J2000 split before conversion: Moon moves half an arc second per second of time
+    double T        = ((jd.day-2451545L) + (double)jd.time)/36525;
+    double TSquared = T*T;
+    double TCubed   = TSquared*T;
+    double TFourth  = TSquared*TSquared;
+    
+    // Mean longitude L' and fundamental arguments D, M, M', F (chapter 47)
+    double Lp = 218.3164477 + T*481267.88123421 - TSquared*0.0015786 + TCubed/538841   - TFourth/65194000;
+    double D  = 297.8501921 + T*445267.1114034  - TSquared*0.0018819 + TCubed/545868   - TFourth/113065000;
+    double M  = 357.5291092 + T*35999.0502909   - TSquared*0.0001536 + TCubed/24490000;
+    double Mm = 134.9633964 + T*477198.8675055  + TSquared*0.0087414 + TCubed/69699    - TFourth/14712000;
+    double F  = 93.2720950  + T*483202.0175233  - TSquared*0.0036539 - TCubed/3526000  + TFourth/863310000;
+    
+    // Reduced to [0,360[ before single precision
+    float arguments[4] =
+    {
+        (float)(D  - 360*floor(D/360)),
+        (float)(M  - 360*floor(M/360)),
+        (float)(Mm - 360*floor(Mm/360)),
+        (float)(F  - 360*floor(F/360))
+    };
+    float L = (float)(Lp - 360*floor(Lp/360));
+    
+    float A1 = 119.75 + 131.849*T;
+    float A2 = 53.09  + 479264.290*T;
+    float A3 = 313.45 + 481266.484*T;
+    
+    // Eccentricity of Earth orbit decreasing
+    float E = 1 - 0.002516*T - 0.0000074*TSquared;
+    
+    float sumL, sumR, sumB, unused;
+    
+#if EPHEMERIS_USE_SOA
+    VSOP87SoA::sumMoonSeries(VSOP87SoA::moonSeries(false), arguments, E, &sumL, &sumR);
+    VSOP87SoA::sumMoonSeries(VSOP87SoA::moonSeries(true),  arguments, E, &sumB, &unused);
+#else
+    sumL = sumR = sumB = unused = 0;
+    for(int numTerm=0; numTerm<MOON_TERM_COUNT; numTerm++)
+    {
+        MoonTerm terms[2];
+        
+#if ARDUINO
+        memcpy_P(&terms[0], &MoonLongitudeDistanceTerms[numTerm], sizeof(MoonTerm));
+        memcpy_P(&terms[1], &MoonLatitudeTerms[numTerm], sizeof(MoonTerm));
+#else
+        terms[0] = MoonLongitudeDistanceTerms[numTerm];
+        terms[1] = MoonLatitudeTerms[numTerm];
+#endif
+        
+        for(int table=0; table<2; table++)
+        {
+            MoonTerm *term = &terms[table];
+            
+            float argument = term->D*arguments[0] + term->M*arguments[1] + term->Mm*arguments[2] + term->F*arguments[3];
+            float factor   = term->M == 0 ? 1 : (term->M == 1 || term->M == -1 ? E : E*E);
+            
+            float sine, cosine;
+            SINCOSD(argument, &sine, &cosine);
+            
+            if( table == 0 )
+            {
+                sumL += factor*term->sine*sine;
+                sumR += factor*term->cosine*cosine;
+            }
+            else
+            {
+                sumB += factor*term->sine*sine;
+            }
+        }
+    }
+#endif
+    
+    // Venus (A1), Jupiter (A2) and flattening of Earth
+    sumL += 3958*SIND(A1) + 1962*SIND(L-arguments[3]) + 318*SIND(A2);
+    sumB += -2235*SIND(L) + 382*SIND(A3) + 175*SIND(A1-arguments[3]) + 175*SIND(A1+arguments[3])
+            + 127*SIND(L-arguments[2]) - 115*SIND(L+arguments[2]);
+    
+    GeocentricCoordinates coordinates;
+    coordinates.lon = L + sumL/1000000;
+    coordinates.lon = LIMIT_DEGREES_TO_360(coordinates.lon);
+    coordinates.lat = sumB/1000000;
+    
+    if( distance )
+    {
+        *distance = 385000.56 + sumR/1000;
+    }
+    
+    return coordinates;
+}
+
+EquatorialCoordinates Ephemeris::equatorialCoordinatesForMoonAtEpoch(const EphemerisEpoch *epoch, float *distance)
+{
+    float kilometers;
+    GeocentricCoordinates coordinates = geocentricCoordinatesForMoon(epoch->jd, &kilometers);
+    
+    if( distance )
+    {
+        *distance = kilometers/KILOMETERS_PER_AU;
+    }
+    
+    // Apparent longitude (light time is included in L', aberration is negligible)
+    return EclipticToEquatorial(coordinates.lon + epoch->deltaNutation/3600, coordinates.lat, epoch->obliquity);
+}
+
 PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solarSystemObjectIndex, float T)
 {
     PlanetayOrbit planetayOrbit;
@@ -296,7 +617,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 48.330893    + 1.1861883*T      + 0.00017542*TSquared   + 0.000000215*TCubed;
             planetayOrbit.pi    = 77.456119    + 1.5564776*T      + 0.00029544*TSquared   + 0.000000009*TCubed;
             break;
-            
+        
         case Venus:
             planetayOrbit.L     = 181.979801   + 58519.2130302*T + 0.00031014*TSquared   + 0.000000015*TCubed;
             planetayOrbit.a     = 0.723329820;
@@ -305,7 +626,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 76.679920    + 0.9011206*T     + 0.00040618*TSquared   - 0.000000093*TCubed;
             planetayOrbit.pi    = 131.563703   + 1.4022288*T     - 0.00107618*TSquared   - 0.000005678*TCubed;
             break;
-            
+        
         case Earth:
             planetayOrbit.L     = 100.466457   + 36000.7698278*T + 0.00030322*TSquared   + 0.000000020*TCubed;
             planetayOrbit.a     = 1.000001018;
@@ -314,7 +635,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = NAN;
             planetayOrbit.pi    = 102.937348   + 1.17195366*T    + 0.00045688*TSquared   - 0.000000018*TCubed;
             break;
-            
+        
         case Mars:
             planetayOrbit.L     = 355.433000   + 19141.6964471*T + 0.00031052*TSquared   + 0.000000016*TCubed;
             planetayOrbit.a     = 1.523679342;
@@ -323,7 +644,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 49.588093    + 0.7720959*T     + 0.00001557*TSquared   + 0.000002267*TCubed;
             planetayOrbit.pi    = 336.060234   + 1.8410449*T     + 0.00013477*TSquared   + 0.000000536*TCubed;
             break;
-            
+        
         case Jupiter:
             planetayOrbit.L     = 34.351519   + 3036.3027748*T  + 0.00022330*TSquared   + 0.000000037*TCubed;
             planetayOrbit.a     = 5.202603209 + 0.0000001913*T;
@@ -332,7 +653,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 100.464407  + 1.0209774*T     + 0.00040315*TSquared   + 0.000000404*TCubed;
             planetayOrbit.pi    = 14.331207   + 1.6126352*T     + 0.00103042*TSquared   - 0.000004464*TCubed;
             break;
-            
+        
         case Saturn:
             planetayOrbit.L     = 50.077444   + 1223.5110686*T + 0.00051908*TSquared   - 0.000000030*TCubed;
             planetayOrbit.a     = 9.554909192 - 0.0000021390*T + 0.000000004*TSquared;
@@ -341,7 +662,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 113.665503  + 0.8770880*T    - 0.00012176*TSquared   - 0.000002249*TCubed;
             planetayOrbit.pi    = 93.057237   + 1.9637613*T    + 0.00083753*TSquared   + 0.000004928*TCubed;
             break;
-            
+        
         case Uranus:
             planetayOrbit.L     = 314.055005   + 429.8640561*T  + 0.00030390*TSquared     + 0.000000026*TCubed;
             planetayOrbit.a     = 19.218446062 - 0.0000000372*T + 0.00000000098*TSquared;
@@ -350,7 +671,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 74.005957    + 0.5211278*T    + 0.00133947*TSquared     + 0.000018484*TCubed;
             planetayOrbit.pi    = 173.005291   + 1.4863790*T    + 0.00021406*TSquared     + 0.000000434*TCubed;
             break;
-            
+        
         case Neptune:
             planetayOrbit.L     = 304.348665   + 219.8833092*T  + 0.00030882*TSquared     + 0.000000018*TCubed;
             planetayOrbit.a     = 30.110386869 - 0.0000001663*T + 0.00000000069*TSquared;
@@ -359,7 +680,7 @@ PlanetayOrbit Ephemeris::planetayOrbitForPlanetAndT(SolarSystemObjectIndex solar
             planetayOrbit.omega = 131.784057   + 1.1022039*T    + 0.00025952*TSquared     - 0.000000637*TCubed;
             planetayOrbit.pi    = 48.120276    + 1.4262957*T    + 0.00038434*TSquared     + 0.000000020*TCubed;
             break;
-            
+        
         default:
             // Unknow planet
             break;
@@ -425,7 +746,7 @@ float Ephemeris::sumVSOP87Coefs(const VSOP87Coefficient *valuePlanetCoefficients
         coef = valuePlanetCoefficients[numCoef];
 #endif
         
-        float res = cos(coef.B + coef.C*T);
+        float res = COSR(coef.B + coef.C*T);
         
         // To avoid out of range issue with single precision
         // we've stored sqrt(A) and not A. As a result we need to square it back.
@@ -438,15 +759,80 @@ float Ephemeris::sumVSOP87Coefs(const VSOP87Coefficient *valuePlanetCoefficients
     return value;
 }
 
+float Ephemeris::sumVSOP87Series(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, int termCount, float T)
+{
+#if EPHEMERIS_USE_SOA
+    // Vectorized evaluation on structure of arrays copy of the table
+    const VSOP87SeriesSoA *series = VSOP87SoA::seriesForCoefficients(valuePlanetCoefficients, coefCount);
+    if( series )
+    {
+        return VSOP87SoA::sumSeries(series, termCount, T);
+    }
+#else
+    (void)coefCount;
+#endif
+    
+    // Scalar reference
+    return sumVSOP87Coefs(valuePlanetCoefficients, termCount, T);
+}
+
+float Ephemeris::sumVSOP87CoefsAndRate(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, float T, float *rate)
+{
+    // d/dT A*cos(B+C*T) = -A*C*sin(B+C*T): same argument, one sine and cosine per term
+    float value     = 0;
+    float valueRate = 0;
+    for(int numCoef=0; numCoef<coefCount; numCoef++)
+    {
+        VSOP87Coefficient coef;
+        
+#if ARDUINO
+        memcpy_P(&coef, &valuePlanetCoefficients[numCoef], sizeof(VSOP87Coefficient));
+#else
+        coef = valuePlanetCoefficients[numCoef];
+#endif
+        
+        float sine, cosine;
+        SINCOSR(coef.B + coef.C*T, &sine, &cosine);
+        
+        // sqrt(A) is stored in VSOP87.h (squared in the same order as sumVSOP87Coefs)
+        value     += cosine*coef.A*coef.A;
+        valueRate -= sine*coef.A*coef.A*coef.C;
+    }
+    
+    *rate = valueRate;
+    
+    return value;
+}
+
+float Ephemeris::sumVSOP87SeriesAndRate(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, int termCount, float T, float *rate)
+{
+#if EPHEMERIS_USE_SOA
+    const VSOP87SeriesSoA *series = VSOP87SoA::seriesForCoefficients(valuePlanetCoefficients, coefCount);
+    if( series )
+    {
+        return VSOP87SoA::sumSeriesAndRate(series, termCount, T, rate);
+    }
+#else
+    (void)coefCount;
+#endif
+    
+    return sumVSOP87CoefsAndRate(valuePlanetCoefficients, termCount, T, rate);
+}
+
 HorizontalCoordinates Ephemeris::equatorialToHorizontal(float H, float delta, float phi)
 {
     HorizontalCoordinates coordinates;
     
-    coordinates.azi = atan2(SIND(H), COSD(H)*SIND(phi)-TAND(delta)*COSD(phi));
+    float sinH, cosH, sinDelta, cosDelta, sinPhi, cosPhi;
+    SINCOSD(H,     &sinH,     &cosH);
+    SINCOSD(delta, &sinDelta, &cosDelta);
+    SINCOSD(phi,   &sinPhi,   &cosPhi);
+    
+    coordinates.azi = atan2(sinH, cosH*sinPhi-sinDelta/cosDelta*cosPhi);
     coordinates.azi = RADIANS_TO_DEGREES(coordinates.azi)+180;
     coordinates.azi = LIMIT_DEGREES_TO_360(coordinates.azi);
     
-    coordinates.alt = asin(SIND(phi)*SIND(delta) + COSD(phi)*COSD(delta)*COSD(H));
+    coordinates.alt = asin(sinPhi*sinDelta + cosPhi*cosDelta*cosH);
     coordinates.alt = RADIANS_TO_DEGREES(coordinates.alt);
     
     return coordinates;
@@ -454,16 +840,17 @@ HorizontalCoordinates Ephemeris::equatorialToHorizontal(float H, float delta, fl
 
 EquatorialCoordinates Ephemeris::EclipticToEquatorial(float lambda, float beta, float epsilon)
 {
-    lambda  = DEGREES_TO_RADIANS(lambda);
-    beta    = DEGREES_TO_RADIANS(beta);
-    epsilon = DEGREES_TO_RADIANS(epsilon);
+    float sinLambda, cosLambda, sinBeta, cosBeta, sinEpsilon, cosEpsilon;
+    SINCOSD(lambda,  &sinLambda,  &cosLambda);
+    SINCOSD(beta,    &sinBeta,    &cosBeta);
+    SINCOSD(epsilon, &sinEpsilon, &cosEpsilon);
     
     EquatorialCoordinates coordinates;
-    coordinates.ra = atan2(sin(lambda)*cos(epsilon) - tan(beta)*sin(epsilon), cos(lambda));
+    coordinates.ra = atan2(sinLambda*cosEpsilon - sinBeta/cosBeta*sinEpsilon, cosLambda);
     coordinates.ra = RADIANS_TO_HOURS(coordinates.ra);
     coordinates.ra = LIMIT_HOURS_TO_24(coordinates.ra);
     
-    coordinates.dec = asin(sin(beta)*cos(epsilon) + cos(beta)*sin(epsilon)*sin(lambda));
+    coordinates.dec = asin(sinBeta*cosEpsilon + cosBeta*sinEpsilon*sinLambda);
     coordinates.dec = RADIANS_TO_DEGREES(coordinates.dec );
     
     return coordinates;
@@ -473,19 +860,33 @@ RectangularCoordinates Ephemeris::HeliocentricToRectangular(HeliocentricCoordina
 {
     RectangularCoordinates coordinates;
     
-    coordinates.x = hc.radius * COSD(hc.lat) * COSD(hc.lon) - hc0.radius * COSD(hc0.lat) * COSD(hc0.lon);
-    coordinates.y = hc.radius * COSD(hc.lat) * SIND(hc.lon) - hc0.radius * COSD(hc0.lat) * SIND(hc0.lon);
-    coordinates.z = hc.radius * SIND(hc.lat)                - hc0.radius * SIND(hc0.lat);
+    float sinLat,  cosLat,  sinLon,  cosLon;
+    float sinLat0, cosLat0, sinLon0, cosLon0;
+    SINCOSD(hc.lat,  &sinLat,  &cosLat);
+    SINCOSD(hc.lon,  &sinLon,  &cosLon);
+    SINCOSD(hc0.lat, &sinLat0, &cosLat0);
+    SINCOSD(hc0.lon, &sinLon0, &cosLon0);
+    
+    coordinates.x = hc.radius * cosLat * cosLon - hc0.radius * cosLat0 * cosLon0;
+    coordinates.y = hc.radius * cosLat * sinLon - hc0.radius * cosLat0 * sinLon0;
+    coordinates.z = hc.radius * sinLat          - hc0.radius * sinLat0;
     
     return coordinates;
 }
 
-float Ephemeris::meanGreenwichSiderealTimeAtDateAndTime(unsigned int day,   unsigned int month,   unsigned int year,
-                                                        unsigned int hours, unsigned int minutes, unsigned int seconds)
+float Ephemeris::meanGreenwichSiderealTimeForJulianDay(JulianDay jd)
 {
     float meanGreenwichSiderealTime;
     
-    JulianDay jd0 = Calendar::julianDayForDateAndTime(day, month, year, 0, 0, 0);
+    // Seconds from midnight (time 0.5 is 0h) and Julian day at midnight
+    float seconds = jd.time*86400 + 43200;
+    long  days    = (long)floor(seconds/86400);
+    seconds -= days*86400;
+    
+    JulianDay jd0;
+    jd0.day  = jd.day + days - 1;
+    jd0.time = 0.5;
+    
     float T0        = jd0.day/36525.0-2451545.0/36525.0+jd0.time/36525.0;
     float T0Squared = T0*T0;
     float T0Cubed   = T0Squared*T0;
@@ -496,7 +897,7 @@ float Ephemeris::meanGreenwichSiderealTimeAtDateAndTime(unsigned int day,   unsi
     theta0 = DEGREES_TO_FLOATING_HOURS(theta0);
     
     // Sideral time of day
-    float thetaH = 1.00273790935*HOURS_MINUTES_SECONDS_TO_SECONDS(hours,minutes,seconds);
+    float thetaH = 1.00273790935*seconds;
     thetaH = SECONDS_TO_DECIMAL_HOURS(thetaH);
     
     // Add time at midnight and time of day
@@ -509,96 +910,288 @@ SolarSystemObject Ephemeris::solarSystemObjectAtDateAndTime(SolarSystemObjectInd
                                                             unsigned int day,   unsigned int month,   unsigned int year,
                                                             unsigned int hours, unsigned int minutes, unsigned int seconds)
 {
-    SolarSystemObject solarSystemObject;
+    return solarSystemObjectAtDateAndTime(&defaultEphemerisContext, solarSystemObjectIndex, day, month, year, hours, minutes, seconds);
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtDateAndTime(EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex,
+                                                            unsigned int day,   unsigned int month,   unsigned int year,
+                                                            unsigned int hours, unsigned int minutes, unsigned int seconds)
+{
+    return solarSystemObjectAtJulianDay(context, solarSystemObjectIndex,
+                                        Calendar::julianDayForDateAndTime(day, month, year, hours, minutes, seconds));
+}
+
+SolarSystemSnapshot Ephemeris::solarSystemSnapshotAtDateAndTime(unsigned int day,   unsigned int month,   unsigned int year,
+                                                                unsigned int hours, unsigned int minutes, unsigned int seconds)
+{
+    return solarSystemSnapshotAtDateAndTime(&defaultEphemerisContext, day, month, year, hours, minutes, seconds);
+}
+
+SolarSystemSnapshot Ephemeris::solarSystemSnapshotAtDateAndTime(EphemerisContext *context,
+                                                                unsigned int day,   unsigned int month,   unsigned int year,
+                                                                unsigned int hours, unsigned int minutes, unsigned int seconds)
+{
+    return solarSystemSnapshotAtJulianDay(context, Calendar::julianDayForDateAndTime(day, month, year, hours, minutes, seconds));
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtJulianDay(SolarSystemObjectIndex solarSystemObjectIndex, JulianDay jd)
+{
+    return solarSystemObjectAtJulianDay(&defaultEphemerisContext, solarSystemObjectIndex, jd);
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtJulianDay(EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex, JulianDay jd)
+{
+    // Sun and Moon coordinates do not need Earth position
+    EphemerisEpoch epoch;
+    epochForJulianDay(context, jd, solarSystemObjectIndex != Sun && solarSystemObjectIndex != EarthsMoon, &epoch);
+    
+    return solarSystemObjectForEpoch(context, solarSystemObjectIndex, &epoch);
+}
+
+SolarSystemSnapshot Ephemeris::solarSystemSnapshotAtJulianDay(JulianDay jd)
+{
+    return solarSystemSnapshotAtJulianDay(&defaultEphemerisContext, jd);
+}
+
+SolarSystemSnapshot Ephemeris::solarSystemSnapshotAtJulianDay(EphemerisContext *context, JulianDay jd)
+{
+    SolarSystemSnapshot snapshot;
     
-    JulianDay jd = Calendar::julianDayForDateAndTime(day, month, year, hours, minutes, seconds);
+    EphemerisEpoch epoch;
+    epochForJulianDay(context, jd, true, &epoch);
     
+    for(int planet=Sun; planet<=EarthsMoon; planet++)
+    {
+        snapshot.objects[planet] = solarSystemObjectForEpoch(context, (SolarSystemObjectIndex)planet, &epoch);
+    }
+    
+    return snapshot;
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtJulianDate(SolarSystemObjectIndex solarSystemObjectIndex, double julianDate)
+{
+    return solarSystemObjectAtJulianDay(&defaultEphemerisContext, solarSystemObjectIndex, Calendar::julianDayForJulianDate(julianDate));
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtJulianDate(EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex, double julianDate)
+{
+    return solarSystemObjectAtJulianDay(context, solarSystemObjectIndex, Calendar::julianDayForJulianDate(julianDate));
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtT(SolarSystemObjectIndex solarSystemObjectIndex, double T)
+{
+    return solarSystemObjectAtJulianDay(&defaultEphemerisContext, solarSystemObjectIndex, julianDayForT(T));
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectAtT(EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex, double T)
+{
+    return solarSystemObjectAtJulianDay(context, solarSystemObjectIndex, julianDayForT(T));
+}
+
+JulianDay Ephemeris::julianDayForT(double T)
+{
+    // Days from J2000 (JD 2451545.0) are split before adding 2451545, so that single precision keeps time of day
+    double days     = T*36525;
+    double wholeDay = floor(days);
+    
+    JulianDay jd;
+    jd.day  = 2451545 + (long)wholeDay;
+    jd.time = (float)(days-wholeDay);
+    
+    return jd;
+}
+
+float Ephemeris::apparentSiderealTimeForJulianDay(JulianDay jd)
+{
+    return apparentSiderealTimeForJulianDay(&defaultEphemerisContext, jd);
+}
+
+float Ephemeris::apparentSiderealTimeForJulianDay(EphemerisContext *context, JulianDay jd)
+{
+    // Same value as every object computed for this Julian day (Earth position not needed)
+    EphemerisEpoch epoch;
+    epochForJulianDay(context, jd, false, &epoch);
+    
+    return epoch.apparentSiderealTime;
+}
+
+EphemerisContext *Ephemeris::defaultContext()
+{
+    return &defaultEphemerisContext;
+}
+
+void Ephemeris::epochForDateAndTime(EphemerisContext *context,
+                                    unsigned int day,   unsigned int month,   unsigned int year,
+                                    unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                    bool withEarth, EphemerisEpoch *epoch)
+{
+    epochForJulianDay(context, Calendar::julianDayForDateAndTime(day, month, year, hours, minutes, seconds), withEarth, epoch);
+}
+
+void Ephemeris::epochForJulianDay(EphemerisContext *context, JulianDay jd, bool withEarth, EphemerisEpoch *epoch)
+{
     float T = jd.day/36525.0-2451545.0/36525.0+jd.time/36525.0;
     
+    epoch->jd = jd;
+    epoch->T  = T;
     
-    // Equatorial coordinates
-    if( solarSystemObjectIndex == Sun )
+    if( withEarth )
     {
-        solarSystemObject.equaCoordinates = equatorialCoordinatesForSunAtJD(jd,
-                                                                            &solarSystemObject.distance,
-                                                                            NULL);
+        epoch->earth = heliocentricCoordinatesForPlanetAndT(context, Earth, T);
     }
     else
     {
-        solarSystemObject.equaCoordinates = equatorialCoordinatesForPlanetAtJD(solarSystemObjectIndex,
-                                                                               jd,
-                                                                               &solarSystemObject.distance,
-                                                                               NULL);
+        epoch->earth.lon    = NAN;
+        epoch->earth.lat    = NAN;
+        epoch->earth.radius = NAN;
     }
     
-    // Apparent diameter at a distance of 1 astronomical unit.
-    float diameter = 0;
-    switch (solarSystemObjectIndex)
+    // Slow terms are computed at the center of the window containing T, so that results do not depend on previous calls
+    float window = context->slowTermsWindow;
+    float slowT  = window > 0 ? floor(T/window+0.5)*window : T;
+    
+    EphemerisSlowTerms *slowTerms = &context->slowTerms;
+    if( slowTerms->T != slowT || slowTerms->window != window )
     {
-        case Mercury:
-            diameter = 6.728;
-            break;
-            
-        case Venus:
-            diameter = 16.688;
-            break;
-            
-        case Earth:
-            diameter = NAN;
-            break;
-            
-        case Mars:
-            diameter = 9.364;
-            break;
-            
-        case Jupiter:
-            diameter = 197.146;
-            break;
-            
+        // Obliquity and Nutation
+        slowTerms->obliquity = obliquityAndNutationForT(slowT, &slowTerms->deltaObliquity, &slowTerms->deltaNutation);
+        
+        // Earth orbit (aberration)
+        PlanetayOrbit earthOrbit = planetayOrbitForPlanetAndT(Earth, slowT);
+        slowTerms->earthEccentricity = earthOrbit.e;
+        slowTerms->earthPerihelion   = earthOrbit.pi;
+        
+        slowTerms->window = window;
+        slowTerms->T      = slowT;
+    }
+    
+    epoch->obliquity         = slowTerms->obliquity;
+    epoch->deltaObliquity    = slowTerms->deltaObliquity;
+    epoch->deltaNutation     = slowTerms->deltaNutation;
+    epoch->earthEccentricity = slowTerms->earthEccentricity;
+    epoch->earthPerihelion   = slowTerms->earthPerihelion;
+    
+    // Sun true longitude and anomaly
+    {
+        float TSquared = T*T;
+        
+        float L0 = 280.46646 + T*36000.76983 + TSquared*0.0003032;
+        L0 = LIMIT_DEGREES_TO_360(L0);
+        
+        float M = 357.52911 + T*35999.05029  - TSquared*0.0001537;
+        M = LIMIT_DEGREES_TO_360(M);
+        
+        float C =
+        +(1.914602 - T*0.004817 - TSquared*0.000014) * SIND(M)
+        +(0.019993 - T*0.000101                    ) * SIND(2*M)
+        + 0.000289                                   * SIND(3*M);
+        
+        epoch->sunLongitude = L0 + C;
+        epoch->sunAnomaly   = M  + C;
+    }
+    
+    float meanSideralTime = meanGreenwichSiderealTimeForJulianDay(jd);
+    
+    // Apparent sideral time in floating hours
+    epoch->apparentSiderealTime = meanSideralTime + (epoch->deltaNutation/15*COSD(epoch->obliquity))/3600;
+}
+
+SolarSystemObject Ephemeris::solarSystemObjectForEpoch(const EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex,
+                                                       const EphemerisEpoch *epoch)
+{
+    SolarSystemObject solarSystemObject;
+    
+    // Equatorial coordinates
+    if( solarSystemObjectIndex == Sun )
+    {
+        solarSystemObject.equaCoordinates = equatorialCoordinatesForSunAtEpoch(epoch,
+                                                                               &solarSystemObject.distance,
+                                                                               NULL);
+    }
+    else if( solarSystemObjectIndex == EarthsMoon )
+    {
+        solarSystemObject.equaCoordinates = equatorialCoordinatesForMoonAtEpoch(epoch, &solarSystemObject.distance);
+    }
+    else
+    {
+        solarSystemObject.equaCoordinates = equatorialCoordinatesForPlanetAtEpoch(context,
+                                                                                  solarSystemObjectIndex,
+                                                                                  epoch,
+                                                                                  &solarSystemObject.distance,
+                                                                                  NULL);
+    }
+    
+    // Apparent diameter at a distance of 1 astronomical unit.
+    float diameter = 0;
+    switch (solarSystemObjectIndex)
+    {
+        case Mercury:
+            diameter = 6.728;
+            break;
+        
+        case Venus:
+            diameter = 16.688;
+            break;
+        
+        case Earth:
+            diameter = NAN;
+            break;
+        
+        case Mars:
+            diameter = 9.364;
+            break;
+        
+        case Jupiter:
+            diameter = 197.146;
+            break;
+        
         case Saturn:
             diameter = 166.197;
             break;
-            
+        
         case Uranus:
             diameter = 70.476;
             break;
-            
+        
         case Neptune:
             diameter = 68.285;
             break;
-            
+        
         case Sun:
             diameter = 1919.26;
             break;
-            
-        /*case EarthsMoon:
-            // TODO
-            break;*/
+        
+        case EarthsMoon:
+            // 2 x 358473400 km arc seconds (Meeus chapter 55) at 1 AU
+            diameter = 4.79254;
+            break;
     }
     
     // Approximate apparent diameter in arc minutes according to distance
     solarSystemObject.diameter = diameter / solarSystemObject.distance/60;
     
-    float meanSideralTime = meanGreenwichSiderealTimeAtDateAndTime(day, month, year, hours, minutes, seconds);
-    
-    float deltaNutation;
-    float epsilon = obliquityAndNutationForT(T, NULL, &deltaNutation);
-    
     // Apparent sideral time in floating hours
-    float theta0 = meanSideralTime + (deltaNutation/15*COSD(epsilon))/3600;
+    float theta0 = epoch->apparentSiderealTime;
     
-    if( !isnan(longitudeOnEarth) && !isnan(latitudeOnEarth) )
+    if( !isnan(context->longitude) && !isnan(context->latitude) )
     {
         // Geographic longitude in floating degrees
-        float L = DEGREES_TO_FLOATING_HOURS(longitudeOnEarth);
+        float L = DEGREES_TO_FLOATING_HOURS(context->longitude);
         
         // Geographic latitude in floating degrees
-        float phi = latitudeOnEarth;
+        float phi = context->latitude;
         
         // Local angle in floating degrees
         float H = (theta0-L-solarSystemObject.equaCoordinates.ra)*15;
         
         solarSystemObject.horiCoordinates = equatorialToHorizontal(H,solarSystemObject.equaCoordinates.dec,phi);
+        
+        if( solarSystemObjectIndex == EarthsMoon )
+        {
+            // Topocentric altitude (horizontal parallax of the Moon is about one degree)
+            float parallax = RADIANS_TO_DEGREES(asin(EARTH_EQUATORIAL_RADIUS/(solarSystemObject.distance*KILOMETERS_PER_AU)));
+            solarSystemObject.horiCoordinates.alt -= parallax*COSD(solarSystemObject.horiCoordinates.alt);
+        }
     }
     else
     {
@@ -609,72 +1202,339 @@ SolarSystemObject Ephemeris::solarSystemObjectAtDateAndTime(SolarSystemObjectInd
     return solarSystemObject;
 }
 
+EphemerisContext::EphemerisContext()
+{
+    latitude  = NAN;
+    longitude = NAN;
+    
+    accuracyTruncation.accuracy = 0;
+    
+    lightTimeMode   = LightTimeIterative;
+    slowTermsWindow = 0;
+    
+    // Empty cache
+    slowTerms.window            = NAN;
+    slowTerms.T                 = NAN;
+    slowTerms.obliquity         = 0;
+    slowTerms.deltaObliquity    = 0;
+    slowTerms.deltaNutation     = 0;
+    slowTerms.earthEccentricity = 0;
+    slowTerms.earthPerihelion   = 0;
+}
+
+void EphemerisContext::setLocationOnEarth(float floatingLatitude, float floatingLongitude)
+{
+    latitude  = floatingLatitude;
+    longitude = floatingLongitude;
+}
+
+void EphemerisContext::setLocationOnEarth(float latDegrees, float latMinutes, float latSeconds,
+                                          float lonDegrees, float lonMinutes, float lonSeconds)
+{
+    latitude  = DEGREES_MINUTES_SECONDS_TO_DECIMAL_DEGREES(latDegrees,latMinutes,latSeconds);
+    longitude = DEGREES_MINUTES_SECONDS_TO_DECIMAL_DEGREES(lonDegrees,lonMinutes,lonSeconds);
+}
+
+void EphemerisContext::setAccuracy(float arcseconds)
+{
+    if( arcseconds > 0 )
+    {
+        Ephemeris::vsop87TruncationForAccuracy(arcseconds, &accuracyTruncation);
+    }
+    else
+    {
+        accuracyTruncation.accuracy = 0;
+    }
+}
+
+void EphemerisContext::setLightTimeMode(LightTimeMode mode)
+{
+    lightTimeMode = mode;
+}
+
+void EphemerisContext::setEpochCacheWindow(float minutes)
+{
+    slowTermsWindow = minutes > 0 ? minutes/(1440*36525.0) : 0;
+}
+
+const VSOP87Truncation *EphemerisContext::truncation() const
+{
+    return accuracyTruncation.accuracy > 0 ? &accuracyTruncation : NULL;
+}
+
+void Ephemeris::setLightTimeMode(LightTimeMode mode)
+{
+    defaultEphemerisContext.setLightTimeMode(mode);
+}
+
+void Ephemeris::setEpochCacheWindow(float minutes)
+{
+    defaultEphemerisContext.setEpochCacheWindow(minutes);
+}
+
+void Ephemeris::setAccuracy(float arcseconds)
+{
+    defaultEphemerisContext.setAccuracy(arcseconds);
+}
+
+void Ephemeris::vsop87TruncationForAccuracy(float arcseconds, VSOP87Truncation *truncation)
+{
+    truncation->accuracy = arcseconds;
+    
+    // Accuracy target in VSOP87 unit (1e-8 radian)
+    float epsilon = arcseconds/3600*PI/180*100000000.0;
+    
+    for(int planet=Sun; planet<=Neptune; planet++)
+    {
+        SolarSystemObjectIndex planetIndex = (SolarSystemObjectIndex)planet;
+        
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            // Error budget is shared by every table of the variable
+            int tableCount = 0;
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                tableCount += vsop87TermCountForPlanet(planetIndex, variable, power) > 0;
+            }
+            
+            if( tableCount == 0 )
+            {
+                memset(truncation->count[planet][variable], 0, sizeof(truncation->count[planet][variable]));
+                continue;
+            }
+            
+            float budget = epsilon/tableCount;
+            
+            if( variable == 2 )
+            {
+                // Radius: same relative accuracy (budget scaled by mean distance, first term of R0)
+                budget *= vsop87AmplitudeForPlanet(planetIndex, 2, 0, 0)/100000000.0;
+            }
+            
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                // Skip smallest terms while their amplitudes (times T^power) stay within budget
+                float tail  = 0;
+                int   count = vsop87TermCountForPlanet(planetIndex, variable, power);
+                while( count > 0 )
+                {
+                    float amplitude = vsop87AmplitudeForPlanet(planetIndex, variable, power, count-1)*pow(VSOP87_TRUNCATION_TAU, power);
+                    if( tail+amplitude > budget )
+                    {
+                        break;
+                    }
+                    
+                    tail += amplitude;
+                    count--;
+                }
+                
+                truncation->count[planet][variable][power] = count;
+            }
+        }
+    }
+}
+
+int Ephemeris::vsop87TermCountForPlanet(SolarSystemObjectIndex solarSystemObjectIndex, int variable, int power)
+{
+#if EPHEMERIS_USE_VSOP87_FILE
+    if( VSOP87File::hasPlanet(solarSystemObjectIndex) )
+    {
+        return VSOP87File::countForPlanet(solarSystemObjectIndex, variable, power);
+    }
+#endif
+    
+    VSOP87PlanetSeries planetSeries;
+    if( !vsop87SeriesForPlanet(solarSystemObjectIndex, &planetSeries) )
+    {
+        return 0;
+    }
+    
+    return planetSeries.series[variable][power].count;
+}
+
+float Ephemeris::vsop87AmplitudeForPlanet(SolarSystemObjectIndex solarSystemObjectIndex, int variable, int power, int term)
+{
+#if EPHEMERIS_USE_VSOP87_FILE
+    if( VSOP87File::hasPlanet(solarSystemObjectIndex) )
+    {
+        return VSOP87File::amplitudeForPlanet(solarSystemObjectIndex, variable, power, term);
+    }
+#endif
+    
+    VSOP87PlanetSeries planetSeries;
+    vsop87SeriesForPlanet(solarSystemObjectIndex, &planetSeries);
+    
+    VSOP87Coefficient coef;
+#if ARDUINO
+    memcpy_P(&coef, &planetSeries.series[variable][power].coefficients[term], sizeof(VSOP87Coefficient));
+#else
+    coef = planetSeries.series[variable][power].coefficients[term];
+#endif
+    
+    // sqrt(A) is stored in VSOP87.h
+    return coef.A*coef.A;
+}
+
+#if EPHEMERIS_USE_VSOP87_FILE
+bool Ephemeris::loadVSOP87File(const char *path)
+{
+    if( !VSOP87File::open(path) )
+    {
+        return false;
+    }
+    
+    // Truncation now applies to tables of the file. Other contexts keep their term counts, clamped to the
+    // tables in use by every evaluation: they call setAccuracy again to reach their accuracy with these tables.
+    if( defaultEphemerisContext.truncation() )
+    {
+        setAccuracy(defaultEphemerisContext.truncation()->accuracy);
+    }
+    
+    return true;
+}
+
+void Ephemeris::unloadVSOP87File()
+{
+    VSOP87File::close();
+    
+    if( defaultEphemerisContext.truncation() )
+    {
+        setAccuracy(defaultEphemerisContext.truncation()->accuracy);
+    }
+}
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesFromVSOP87File(SolarSystemObjectIndex solarSystemObjectIndex, float T,
+                                                                         const VSOP87Truncation *truncation)
+{
+    // VSOP87 time unit is thousand of Julian years
+    T = T/10;
+    
+    float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        for(int power=0; power<VSOP87_POWER_COUNT; power++)
+        {
+            int termCount = truncation ? truncation->count[solarSystemObjectIndex][variable][power]
+                                       : VSOP87File::countForPlanet(solarSystemObjectIndex, variable, power);
+            
+            sums[variable][power] = VSOP87File::sumSeries(solarSystemObjectIndex, variable, power, termCount, T);
+        }
+    }
+    
+    return heliocentricCoordinatesForVSOP87Sums(sums, T);
+}
+#endif
+
 void Ephemeris::setLocationOnEarth(float floatingLatitude, float floatingLongitude)
 {
-    latitudeOnEarth  = floatingLatitude;
-    longitudeOnEarth = floatingLongitude;
+    defaultEphemerisContext.setLocationOnEarth(floatingLatitude, floatingLongitude);
 }
 
 void Ephemeris::setLocationOnEarth(float latDegrees, float latMinutes, float latSeconds,
                                    float lonDegrees, float lonMinutes, float lonSeconds)
 {
-    latitudeOnEarth  = DEGREES_MINUTES_SECONDS_TO_DECIMAL_DEGREES(latDegrees,latMinutes,latSeconds);
-    longitudeOnEarth = DEGREES_MINUTES_SECONDS_TO_DECIMAL_DEGREES(lonDegrees,lonMinutes,lonSeconds);
+    defaultEphemerisContext.setLocationOnEarth(latDegrees, latMinutes, latSeconds, lonDegrees, lonMinutes, lonSeconds);
 }
 
-EquatorialCoordinates  Ephemeris::equatorialCoordinatesForPlanetAtJD(SolarSystemObjectIndex solarSystemObjectIndex, JulianDay jd,
-                                                                     float *distance, GeocentricCoordinates *gCoordinates)
+EquatorialCoordinates  Ephemeris::equatorialCoordinatesForPlanetAtEpoch(const EphemerisContext *context,
+                                                                        SolarSystemObjectIndex solarSystemObjectIndex, const EphemerisEpoch *epoch,
+                                                                        float *distance, GeocentricCoordinates *gCoordinates)
 {
     EquatorialCoordinates coordinates;
     coordinates.ra  = 0;
     coordinates.dec = 0;
     
-    float T      = (jd.day-2451545.0+jd.time)/36525;
-    float lastT  = 0;
-    float TLight = 0;
+    if( solarSystemObjectIndex == Earth )
+    {
+        // Do not work for Earth of course...
+        coordinates.ra  = NAN;
+        coordinates.dec = NAN;
+        
+        if( distance )
+        {
+            *distance = 0;
+        }
+        
+        return coordinates;
+    }
+    
+    float T      = epoch->T;
     HeliocentricCoordinates hcPlanet;
-    HeliocentricCoordinates hcEarth;
     RectangularCoordinates  rectPlanet;
     
-    JulianDay jd2;
-    jd2.day  = jd.day;
-    jd2.time = jd.time;
-    
     float x2,y2,z2;
     
-    // Iterate for good precision according to light speed delay
-    while (T != lastT)
+    if( context->lightTimeMode == LightTimeVelocity )
     {
-        lastT = T;
-        
-        float jd2 = (jd.day+jd.time) - TLight;
-        T = (jd2-2451545.0)/36525;
+        // One evaluation: planet is moved back along its velocity during light time (Earth stays at epoch)
+        HeliocentricCoordinates velocity;
+        HeliocentricCoordinates hcEpoch = Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(context, solarSystemObjectIndex, T, &velocity);
         
-        hcPlanet   = Ephemeris::heliocentricCoordinatesForPlanetAndT(solarSystemObjectIndex, T);
-        if( isnan(hcPlanet.radius)  )
+        hcPlanet = hcEpoch;
+        for(int step=0; step<=EPHEMERIS_LIGHT_TIME_VELOCITY_STEPS; step++)
         {
-            break;
+            rectPlanet = HeliocentricToRectangular(hcPlanet,epoch->earth);
+            
+            // Precomputed square
+            x2 = rectPlanet.x*rectPlanet.x;
+            y2 = rectPlanet.y*rectPlanet.y;
+            z2 = rectPlanet.z*rectPlanet.z;
+            
+            // Real distance from Earth
+            float delta = sqrtf(x2+y2+z2);
+            
+            if( distance )
+            {
+                *distance = delta;
+            }
+            
+            if( step == EPHEMERIS_LIGHT_TIME_VELOCITY_STEPS )
+            {
+                break;
+            }
+            
+            // Light time (in days) applied to position at epoch
+            float TLight = delta * 0.0057755183;
+            
+            hcPlanet.lon    = hcEpoch.lon    - velocity.lon*TLight;
+            hcPlanet.lat    = hcEpoch.lat    - velocity.lat*TLight;
+            hcPlanet.radius = hcEpoch.radius - velocity.radius*TLight;
         }
+    }
+    else
+    {
+        float lastT = NAN;
         
-        hcEarth    = Ephemeris::heliocentricCoordinatesForPlanetAndT(Earth, T);
-        
-        rectPlanet = HeliocentricToRectangular(hcPlanet,hcEarth);
-        
-        // Precomputed square
-        x2 = rectPlanet.x*rectPlanet.x;
-        y2 = rectPlanet.y*rectPlanet.y;
-        z2 = rectPlanet.z*rectPlanet.z;
-        
-        // Real distance from Earth
-        float delta = sqrtf(x2+y2+z2);
-        
-        if( distance )
+        // Iterate for good precision according to light speed delay (Earth stays at epoch)
+        for(int iteration=0; iteration<EPHEMERIS_LIGHT_TIME_ITERATIONS && T != lastT; iteration++)
         {
-            *distance = delta;
+            lastT = T;
+            
+            hcPlanet   = Ephemeris::heliocentricCoordinatesForPlanetAndT(context, solarSystemObjectIndex, T);
+            if( isnan(hcPlanet.radius)  )
+            {
+                break;
+            }
+            
+            rectPlanet = HeliocentricToRectangular(hcPlanet,epoch->earth);
+            
+            // Precomputed square
+            x2 = rectPlanet.x*rectPlanet.x;
+            y2 = rectPlanet.y*rectPlanet.y;
+            z2 = rectPlanet.z*rectPlanet.z;
+            
+            // Real distance from Earth
+            float delta = sqrtf(x2+y2+z2);
+            
+            if( distance )
+            {
+                *distance = delta;
+            }
+            
+            // Light time (in days, removed from T and not from Julian day to keep single precision)
+            float TLight = delta * 0.0057755183;
+            T = epoch->T - TLight/36525;
         }
-        
-        // Light time
-        TLight = delta * 0.0057755183;
     }
     
     
@@ -690,28 +1550,13 @@ EquatorialCoordinates  Ephemeris::equatorialCoordinatesForPlanetAtJD(SolarSystem
     
     // Remove abberation
     {
-        PlanetayOrbit earthOrbit = Ephemeris::planetayOrbitForPlanetAndT(Earth, T);
-        
-        float TSquared = T*T;
-        
-        float L0 = 280.46646 + T*36000.76983 + TSquared*0.0003032;
-        L0 = LIMIT_DEGREES_TO_360(L0);
-        
-        float M = 357.52911 + T*35999.05029  - TSquared*0.0001537;
-        M = LIMIT_DEGREES_TO_360(M);
-        
-        float C =
-        +(1.914602 - T*0.004817 - TSquared*0.000014) * SIND(M)
-        +(0.019993 - T*0.000101                    ) * SIND(2*M)
-        + 0.000289                                   * SIND(3*M);
-        
         // Sun longitude
-        float O = L0 + C;
+        float O = epoch->sunLongitude;
         
         // Abberation
         float k = 20.49552;
-        float xAberration = (-k*COSD(O - lambda) + earthOrbit.e*k*COSD(earthOrbit.pi - lambda)) / COSD(beta)/3600;
-        float yAberration = -k*SIND(beta)*(SIND(O - lambda) - earthOrbit.e*SIND(earthOrbit.pi - lambda))/3600;
+        float xAberration = (-k*COSD(O - lambda) + epoch->earthEccentricity*k*COSD(epoch->earthPerihelion - lambda)) / COSD(beta)/3600;
+        float yAberration = -k*SIND(beta)*(SIND(O - lambda) - epoch->earthEccentricity*SIND(epoch->earthPerihelion - lambda))/3600;
         lambda -= xAberration;
         beta   -= yAberration;
     }
@@ -722,261 +1567,370 @@ EquatorialCoordinates  Ephemeris::equatorialCoordinatesForPlanetAtJD(SolarSystem
         gCoordinates->lat = beta;
     }
     
-    // Obliquity and Nutation
-    float deltaNutation;
-    float epsilon = Ephemeris::obliquityAndNutationForT(T, NULL, &deltaNutation);
-    
     // Intergrate nutation
-    lambda += deltaNutation/3600;
+    lambda += epoch->deltaNutation/3600;
+    
+    return EclipticToEquatorial(lambda, beta, epoch->obliquity);
+}
+
+template<int planet, int variable, int power>
+inline float Ephemeris::sumVSOP87SeriesForPlanet(float T, const VSOP87Truncation *truncation)
+{
+    // Resolved at compile time (descriptors are never read at run time): missing tables cost nothing
+    constexpr VSOP87Series series = vsop87PlanetSeries[planet].series[variable][power];
+    
+    if( series.count == 0 )
+    {
+        return 0;
+    }
+    
+    int termCount = truncation ? truncation->count[planet][variable][power] : series.count;
+    if( termCount > series.count )
+    {
+        termCount = series.count;
+    }
+    
+    return sumVSOP87Series(series.coefficients, series.count, termCount, T);
+}
+
+template<int planet>
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesForT(float T, const VSOP87Truncation *truncation)
+{
+    // VSOP87 time unit is thousand of Julian years
+    T = T/10;
     
-    return EclipticToEquatorial(lambda, beta, epsilon);
+    float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT] =
+    {
+        // L
+        {
+            sumVSOP87SeriesForPlanet<planet,0,0>(T,truncation), sumVSOP87SeriesForPlanet<planet,0,1>(T,truncation), sumVSOP87SeriesForPlanet<planet,0,2>(T,truncation),
+            sumVSOP87SeriesForPlanet<planet,0,3>(T,truncation), sumVSOP87SeriesForPlanet<planet,0,4>(T,truncation), sumVSOP87SeriesForPlanet<planet,0,5>(T,truncation)
+        },
+        
+        // B
+        {
+            sumVSOP87SeriesForPlanet<planet,1,0>(T,truncation), sumVSOP87SeriesForPlanet<planet,1,1>(T,truncation), sumVSOP87SeriesForPlanet<planet,1,2>(T,truncation),
+            sumVSOP87SeriesForPlanet<planet,1,3>(T,truncation), sumVSOP87SeriesForPlanet<planet,1,4>(T,truncation), sumVSOP87SeriesForPlanet<planet,1,5>(T,truncation)
+        },
+        
+        // R
+        {
+            sumVSOP87SeriesForPlanet<planet,2,0>(T,truncation), sumVSOP87SeriesForPlanet<planet,2,1>(T,truncation), sumVSOP87SeriesForPlanet<planet,2,2>(T,truncation),
+            sumVSOP87SeriesForPlanet<planet,2,3>(T,truncation), sumVSOP87SeriesForPlanet<planet,2,4>(T,truncation), sumVSOP87SeriesForPlanet<planet,2,5>(T,truncation)
+        }
+    };
+    
+    return heliocentricCoordinatesForVSOP87Sums(sums, T);
 }
 
 HeliocentricCoordinates  Ephemeris::heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex solarSystemObjectIndex, float T)
 {
-    HeliocentricCoordinates coordinates;
+    return heliocentricCoordinatesForPlanetAndT(solarSystemObjectIndex, T, defaultEphemerisContext.truncation());
+}
+
+HeliocentricCoordinates  Ephemeris::heliocentricCoordinatesForPlanetAndT(const EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex, float T)
+{
+    return heliocentricCoordinatesForPlanetAndT(solarSystemObjectIndex, T, context->truncation());
+}
+
+HeliocentricCoordinates  Ephemeris::heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex solarSystemObjectIndex, float T,
+                                                                         const VSOP87Truncation *truncation)
+{
+    // One evaluation function per planet, every table unrolled
+    typedef HeliocentricCoordinates (*HeliocentricEvaluator)(float T, const VSOP87Truncation *truncation);
+    static const HeliocentricEvaluator evaluators[] =
+    {
+        &heliocentricCoordinatesForT<Sun>,
+        &heliocentricCoordinatesForT<Mercury>,
+        &heliocentricCoordinatesForT<Venus>,
+        &heliocentricCoordinatesForT<Earth>,
+        &heliocentricCoordinatesForT<Mars>,
+        &heliocentricCoordinatesForT<Jupiter>,
+        &heliocentricCoordinatesForT<Saturn>,
+        &heliocentricCoordinatesForT<Uranus>,
+        &heliocentricCoordinatesForT<Neptune>
+    };
+    
+    if( solarSystemObjectIndex < Sun || solarSystemObjectIndex > Neptune )
+    {
+        // Do not work for Moon...
+        HeliocentricCoordinates coordinates = {NAN, NAN, NAN};
+        return coordinates;
+    }
     
+#if EPHEMERIS_USE_VSOP87_FILE
+    if( VSOP87File::hasPlanet(solarSystemObjectIndex) )
+    {
+        // Coefficient file replaces VSOP87.h
+        return heliocentricCoordinatesFromVSOP87File(solarSystemObjectIndex, T, truncation);
+    }
+#endif
+    
+#if EPHEMERIS_FIXED_POINT
+    // Integer tables of VSOP87Fixed.h (no float operation per term)
+    (void)evaluators;
+    return VSOP87FixedPoint::heliocentricCoordinatesForPlanetAndT(solarSystemObjectIndex, T, truncation);
+#else
+    return evaluators[solarSystemObjectIndex](T, truncation);
+#endif
+}
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(SolarSystemObjectIndex solarSystemObjectIndex, float T,
+                                                                                   HeliocentricCoordinates *velocity)
+{
+    return heliocentricCoordinatesAndVelocityForPlanetAndT(solarSystemObjectIndex, T, defaultEphemerisContext.truncation(), velocity);
+}
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(const EphemerisContext *context,
+                                                                                   SolarSystemObjectIndex solarSystemObjectIndex, float T,
+                                                                                   HeliocentricCoordinates *velocity)
+{
+    return heliocentricCoordinatesAndVelocityForPlanetAndT(solarSystemObjectIndex, T, context->truncation(), velocity);
+}
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(SolarSystemObjectIndex solarSystemObjectIndex, float T,
+                                                                                   const VSOP87Truncation *truncation,
+                                                                                   HeliocentricCoordinates *velocity)
+{
+    if( solarSystemObjectIndex < Sun || solarSystemObjectIndex > Neptune )
+    {
+        HeliocentricCoordinates coordinates = {NAN, NAN, NAN};
+        *velocity = coordinates;
+        return coordinates;
+    }
+    
+    // VSOP87 time unit is thousand of Julian years
     T = T/10;
-    float TSquared = T*T;
-    float TCubed   = TSquared*T;
-    float T4       = TCubed*T;
-    float T5       = T4*T;
     
-    int SizeOfVSOP87Coefficient = sizeof(VSOP87Coefficient);
+#if EPHEMERIS_USE_VSOP87_FILE
+    bool fromFile = VSOP87File::hasPlanet(solarSystemObjectIndex);
+#endif
     
-    float l0=0,l1=0,l2=0,l3=0,l4=0,l5=0;
-    float b0=0,b1=0,b2=0,b3=0,b4=0,b5=0;
-    float r0=0,r1=0,r2=0,r3=0,r4=0,r5=0;
+    // No tables for the Sun (every sum stays null)
+    VSOP87PlanetSeries planetSeries;
+    vsop87SeriesForPlanet(solarSystemObjectIndex, &planetSeries);
     
-    switch (solarSystemObjectIndex)
+    float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    float rates[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
     {
-        case Sun:
-            break;
-            
-        case Mercury:
-            
-            l0 = sumVSOP87Coefs(L0MercuryCoefficients,sizeof(L0MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1MercuryCoefficients,sizeof(L1MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2MercuryCoefficients,sizeof(L2MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3MercuryCoefficients,sizeof(L3MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4MercuryCoefficients,sizeof(L4MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5MercuryCoefficients,sizeof(L5MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0MercuryCoefficients,sizeof(B0MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1MercuryCoefficients,sizeof(B1MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2MercuryCoefficients,sizeof(B2MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3MercuryCoefficients,sizeof(B3MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4MercuryCoefficients,sizeof(B4MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0MercuryCoefficients,sizeof(R0MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1MercuryCoefficients,sizeof(R1MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2MercuryCoefficients,sizeof(R2MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3MercuryCoefficients,sizeof(R3MercuryCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Venus:
-            
-            l0 = sumVSOP87Coefs(L0VenusCoefficients,sizeof(L0VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1VenusCoefficients,sizeof(L1VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2VenusCoefficients,sizeof(L2VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3VenusCoefficients,sizeof(L3VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4VenusCoefficients,sizeof(L4VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5VenusCoefficients,sizeof(L5VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0VenusCoefficients,sizeof(B0VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1VenusCoefficients,sizeof(B1VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2VenusCoefficients,sizeof(B2VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3VenusCoefficients,sizeof(B3VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4VenusCoefficients,sizeof(B4VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0VenusCoefficients,sizeof(R0VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1VenusCoefficients,sizeof(R1VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2VenusCoefficients,sizeof(R2VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3VenusCoefficients,sizeof(R3VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r4 = sumVSOP87Coefs(R4VenusCoefficients,sizeof(R4VenusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Earth:
-            
-            l0 = sumVSOP87Coefs(L0EarthCoefficients,sizeof(L0EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1EarthCoefficients,sizeof(L1EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2EarthCoefficients,sizeof(L2EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3EarthCoefficients,sizeof(L3EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4EarthCoefficients,sizeof(L4EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5EarthCoefficients,sizeof(L5EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0EarthCoefficients,sizeof(B0EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1EarthCoefficients,sizeof(B1EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0EarthCoefficients,sizeof(R0EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1EarthCoefficients,sizeof(R1EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2EarthCoefficients,sizeof(R2EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3EarthCoefficients,sizeof(R3EarthCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Mars:
-            
-            l0 = sumVSOP87Coefs(L0MarsCoefficients,sizeof(L0MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1MarsCoefficients,sizeof(L1MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2MarsCoefficients,sizeof(L2MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3MarsCoefficients,sizeof(L3MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4MarsCoefficients,sizeof(L4MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5MarsCoefficients,sizeof(L5MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0MarsCoefficients,sizeof(B0MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1MarsCoefficients,sizeof(B1MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2MarsCoefficients,sizeof(B2MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3MarsCoefficients,sizeof(B3MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4MarsCoefficients,sizeof(B4MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0MarsCoefficients,sizeof(R0MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1MarsCoefficients,sizeof(R1MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2MarsCoefficients,sizeof(R2MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3MarsCoefficients,sizeof(R3MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            r4 = sumVSOP87Coefs(R4MarsCoefficients,sizeof(R4MarsCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Jupiter:
-            
-            l0 = sumVSOP87Coefs(L0JupiterCoefficients,sizeof(L0JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1JupiterCoefficients,sizeof(L1JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2JupiterCoefficients,sizeof(L2JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3JupiterCoefficients,sizeof(L3JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4JupiterCoefficients,sizeof(L4JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5JupiterCoefficients,sizeof(L5JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0JupiterCoefficients,sizeof(B0JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1JupiterCoefficients,sizeof(B1JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2JupiterCoefficients,sizeof(B2JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3JupiterCoefficients,sizeof(B3JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4JupiterCoefficients,sizeof(B4JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            b5 = sumVSOP87Coefs(B5JupiterCoefficients,sizeof(B5JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0JupiterCoefficients,sizeof(R0JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1JupiterCoefficients,sizeof(R1JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2JupiterCoefficients,sizeof(R2JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3JupiterCoefficients,sizeof(R3JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            r4 = sumVSOP87Coefs(R4JupiterCoefficients,sizeof(R4JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            r5 = sumVSOP87Coefs(R5JupiterCoefficients,sizeof(R5JupiterCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Saturn:
-            
-            l0 = sumVSOP87Coefs(L0SaturnCoefficients,sizeof(L0SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1SaturnCoefficients,sizeof(L1SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2SaturnCoefficients,sizeof(L2SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3SaturnCoefficients,sizeof(L3SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4SaturnCoefficients,sizeof(L4SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            l5 = sumVSOP87Coefs(L5SaturnCoefficients,sizeof(L5SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0SaturnCoefficients,sizeof(B0SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1SaturnCoefficients,sizeof(B1SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2SaturnCoefficients,sizeof(B2SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3SaturnCoefficients,sizeof(B3SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4SaturnCoefficients,sizeof(B4SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            b5 = sumVSOP87Coefs(B5SaturnCoefficients,sizeof(B5SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0SaturnCoefficients,sizeof(R0SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1SaturnCoefficients,sizeof(R1SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2SaturnCoefficients,sizeof(R2SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3SaturnCoefficients,sizeof(R3SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            r4 = sumVSOP87Coefs(R4SaturnCoefficients,sizeof(R4SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            r5 = sumVSOP87Coefs(R5SaturnCoefficients,sizeof(R5SaturnCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Uranus:
-            
-            l0 = sumVSOP87Coefs(L0UranusCoefficients,sizeof(L0UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1UranusCoefficients,sizeof(L1UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2UranusCoefficients,sizeof(L2UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3UranusCoefficients,sizeof(L3UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4UranusCoefficients,sizeof(L4UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0UranusCoefficients,sizeof(B0UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1UranusCoefficients,sizeof(B1UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2UranusCoefficients,sizeof(B2UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3UranusCoefficients,sizeof(B3UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4UranusCoefficients,sizeof(B4UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0UranusCoefficients,sizeof(R0UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1UranusCoefficients,sizeof(R1UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2UranusCoefficients,sizeof(R2UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3UranusCoefficients,sizeof(R3UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            r4 = sumVSOP87Coefs(R4UranusCoefficients,sizeof(R4UranusCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-            
-        case Neptune:
-            
-            l0 = sumVSOP87Coefs(L0NeptuneCoefficients,sizeof(L0NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            l1 = sumVSOP87Coefs(L1NeptuneCoefficients,sizeof(L1NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            l2 = sumVSOP87Coefs(L2NeptuneCoefficients,sizeof(L2NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            l3 = sumVSOP87Coefs(L3NeptuneCoefficients,sizeof(L3NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            l4 = sumVSOP87Coefs(L4NeptuneCoefficients,sizeof(L4NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            b0 = sumVSOP87Coefs(B0NeptuneCoefficients,sizeof(B0NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            b1 = sumVSOP87Coefs(B1NeptuneCoefficients,sizeof(B1NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            b2 = sumVSOP87Coefs(B2NeptuneCoefficients,sizeof(B2NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            b3 = sumVSOP87Coefs(B3NeptuneCoefficients,sizeof(B3NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            b4 = sumVSOP87Coefs(B4NeptuneCoefficients,sizeof(B4NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            r0 = sumVSOP87Coefs(R0NeptuneCoefficients,sizeof(R0NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            r1 = sumVSOP87Coefs(R1NeptuneCoefficients,sizeof(R1NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            r2 = sumVSOP87Coefs(R2NeptuneCoefficients,sizeof(R2NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            r3 = sumVSOP87Coefs(R3NeptuneCoefficients,sizeof(R3NeptuneCoefficients)/SizeOfVSOP87Coefficient,T);
-            
-            break;
-            
-        default:
-            // Do not work for Moon...
-            l0 = NAN;
-            l1 = NAN;
-            l2 = NAN;
-            l3 = NAN;
-            l4 = NAN;
-            l5 = NAN;
-            
-            b0 = NAN;
-            b1 = NAN;
-            b2 = NAN;
-            b3 = NAN;
-            b4 = NAN;
-            b5 = NAN;
-            
-            r0 = NAN;
-            r1 = NAN;
-            r2 = NAN;
-            r3 = NAN;
-            r4 = NAN;
-            r5 = NAN;
+        for(int power=0; power<VSOP87_POWER_COUNT; power++)
+        {
+            sums[variable][power]  = 0;
+            rates[variable][power] = 0;
+            
+            int count = vsop87TermCountForPlanet(solarSystemObjectIndex, variable, power);
+            if( count == 0 )
+            {
+                continue;
+            }
+            
+            int termCount = truncation ? truncation->count[solarSystemObjectIndex][variable][power] : count;
+            if( termCount > count )
+            {
+                termCount = count;
+            }
+            
+#if EPHEMERIS_USE_VSOP87_FILE
+            if( fromFile )
+            {
+                sums[variable][power] = VSOP87File::sumSeriesAndRate(solarSystemObjectIndex, variable, power, termCount, T, &rates[variable][power]);
+                continue;
+            }
+#endif
             
+            const VSOP87Series *series = &planetSeries.series[variable][power];
+            sums[variable][power] = sumVSOP87SeriesAndRate(series->coefficients, series->count, termCount, T, &rates[variable][power]);
+        }
+    }
+    
+    return heliocentricCoordinatesForVSOP87SumsAndRates(sums, rates, T, velocity);
+}
+
+void Ephemeris::heliocentricCoordinatesForPlanetAndTimes(SolarSystemObjectIndex solarSystemObjectIndex, const float *T, int count,
+                                                         HeliocentricCoordinates *coordinates)
+{
+    heliocentricCoordinatesForPlanetAndTimes(&defaultEphemerisContext, solarSystemObjectIndex, T, count, coordinates);
+}
+
+void Ephemeris::heliocentricCoordinatesForPlanetAndTimes(const EphemerisContext *context, SolarSystemObjectIndex solarSystemObjectIndex,
+                                                         const float *T, int count, HeliocentricCoordinates *coordinates)
+{
+    const VSOP87Truncation *truncation = context->truncation();
+    
+    int first = 0;
+    
+#if EPHEMERIS_USE_SOA
+    VSOP87PlanetSeries planetSeries;
+    bool hasSeries = vsop87SeriesForPlanet(solarSystemObjectIndex, &planetSeries);
+    
+#if EPHEMERIS_USE_VSOP87_FILE
+    bool fromFile = VSOP87File::hasPlanet(solarSystemObjectIndex);
+    hasSeries = hasSeries || fromFile;
+#endif
+    
+    // Tiles of epochs: each table is walked once per tile and stays in L1 cache
+    for(; hasSeries && first<count; first+=VSOP87_SOA_BATCH_EPOCHS)
+    {
+        int epochCount = count-first < VSOP87_SOA_BATCH_EPOCHS ? count-first : VSOP87_SOA_BATCH_EPOCHS;
+        
+        // VSOP87 time unit is thousand of Julian years (unused lanes repeat last epoch)
+        float tau[VSOP87_SOA_BATCH_EPOCHS];
+        for(int epoch=0; epoch<VSOP87_SOA_BATCH_EPOCHS; epoch++)
+        {
+            tau[epoch] = T[first + (epoch<epochCount ? epoch : epochCount-1)]/10;
+        }
+        
+        float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT][VSOP87_SOA_BATCH_EPOCHS];
+        
+        bool available = true;
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                float *powerSums = sums[variable][power];
+                for(int epoch=0; epoch<VSOP87_SOA_BATCH_EPOCHS; epoch++)
+                {
+                    powerSums[epoch] = 0;
+                }
+                
+                const VSOP87SeriesSoA *seriesSoA;
+                int                    seriesCount;
+                
+#if EPHEMERIS_USE_VSOP87_FILE
+                if( fromFile )
+                {
+                    // Tables of the file are already structure of arrays (NULL for double precision files)
+                    seriesCount = VSOP87File::countForPlanet(solarSystemObjectIndex, variable, power);
+                    seriesSoA   = seriesCount ? VSOP87File::seriesForPlanet(solarSystemObjectIndex, variable, power) : NULL;
+                }
+                else
+#endif
+                {
+                    const VSOP87Series *series = &planetSeries.series[variable][power];
+                    seriesCount = series->count;
+                    seriesSoA   = seriesCount ? VSOP87SoA::seriesForCoefficients(series->coefficients, series->count) : NULL;
+                }
+                
+                if( seriesCount == 0 )
+                {
+                    continue;
+                }
+                
+                if( seriesSoA == NULL )
+                {
+                    available = false;
+                    break;
+                }
+                
+                int termCount = truncation ? truncation->count[solarSystemObjectIndex][variable][power] : seriesCount;
+                if( termCount > seriesCount )
+                {
+                    termCount = seriesCount;
+                }
+                
+                VSOP87SoA::addSeriesForTimes(seriesSoA, termCount, tau, powerSums, VSOP87_SOA_BATCH_EPOCHS);
+            }
+        }
+        
+        if( !available )
+        {
+            // No memory for SoA tables (or double precision file): finish with scalar evaluation
             break;
+        }
+        
+        for(int epoch=0; epoch<epochCount; epoch++)
+        {
+            float epochSums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+            for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+            {
+                for(int power=0; power<VSOP87_POWER_COUNT; power++)
+                {
+                    epochSums[variable][power] = sums[variable][power][epoch];
+                }
+            }
+            
+            coordinates[first+epoch] = heliocentricCoordinatesForVSOP87Sums(epochSums, tau[epoch]);
+        }
     }
+#endif
+    
+    // One epoch at a time
+    for(; first<count; first++)
+    {
+        coordinates[first] = heliocentricCoordinatesForPlanetAndT(solarSystemObjectIndex, T[first], truncation);
+    }
+}
+
+bool Ephemeris::vsop87SeriesForPlanet(SolarSystemObjectIndex solarSystemObjectIndex, VSOP87PlanetSeries *planetSeries)
+{
+    if( solarSystemObjectIndex <= Sun || solarSystemObjectIndex > Neptune )
+    {
+        return false;
+    }
+    
+#if ARDUINO
+    // Descriptors are in flash memory (PROGMEM)
+    memcpy_P(planetSeries, &vsop87PlanetSeries[solarSystemObjectIndex], sizeof(VSOP87PlanetSeries));
+#else
+    *planetSeries = vsop87PlanetSeries[solarSystemObjectIndex];
+#endif
+    
+    return true;
+}
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesForVSOP87Sums(const float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT], float T)
+{
+    HeliocentricCoordinates coordinates;
+    
+    float TSquared = T*T;
+    float TCubed   = TSquared*T;
+    float T4       = TCubed*T;
+    float T5       = T4*T;
+    
+    const float *l = sums[0];
+    const float *b = sums[1];
+    const float *r = sums[2];
     
     // L
-    coordinates.lon  = (l0 + l1*T + l2*TSquared + l3*TCubed + l4*T4 + l5*T5)/100000000.0;
+    coordinates.lon  = (l[0] + l[1]*T + l[2]*TSquared + l[3]*TCubed + l[4]*T4 + l[5]*T5)/100000000.0;
     coordinates.lon  = RADIANS_TO_DEGREES(coordinates.lon);
     coordinates.lon  = LIMIT_DEGREES_TO_360(coordinates.lon);
     
     // B
-    coordinates.lat  = (b0 + b1*T + b2*TSquared + b3*TCubed + b4*T4 + b5*T5)/100000000.0;
+    coordinates.lat  = (b[0] + b[1]*T + b[2]*TSquared + b[3]*TCubed + b[4]*T4 + b[5]*T5)/100000000.0;
     coordinates.lat  = RADIANS_TO_DEGREES(coordinates.lat);
     
     // R
-    coordinates.radius = (r0 + r1*T + r2*TSquared + r3*TCubed + r4*T4 + r5*T5)/100000000.0;
+    coordinates.radius = (r[0] + r[1]*T + r[2]*TSquared + r[3]*TCubed + r[4]*T4 + r[5]*T5)/100000000.0;
     
     return coordinates;
 }
+
+HeliocentricCoordinates Ephemeris::heliocentricCoordinatesForVSOP87SumsAndRates(const float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT],
+                                                                                const float rates[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT],
+                                                                                float T, HeliocentricCoordinates *velocity)
+{
+    float TSquared = T*T;
+    float TCubed   = TSquared*T;
+    float T4       = TCubed*T;
+    float T5       = T4*T;
+    
+    // Derivative of sum(S[p]*T^p) is sum(p*S[p]*T^(p-1) + S'[p]*T^p), per thousand of Julian years
+    float derivatives[VSOP87_VARIABLE_COUNT];
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        const float *s = sums[variable];
+        const float *r = rates[variable];
+        
+        derivatives[variable] = (s[1] + 2*s[2]*T + 3*s[3]*TSquared + 4*s[4]*TCubed + 5*s[5]*T4) +
+                                (r[0] + r[1]*T + r[2]*TSquared + r[3]*TCubed + r[4]*T4 + r[5]*T5);
+    }
+    
+    // 1e-8 radian or AU per thousand of Julian years to degrees or AU per day
+    velocity->lon    = RADIANS_TO_DEGREES(derivatives[0]/(100000000.0*DAYS_PER_MILLENNIUM));
+    velocity->lat    = RADIANS_TO_DEGREES(derivatives[1]/(100000000.0*DAYS_PER_MILLENNIUM));
+    velocity->radius = derivatives[2]/(100000000.0*DAYS_PER_MILLENNIUM);
+    
+    return heliocentricCoordinatesForVSOP87Sums(sums, T);
+}
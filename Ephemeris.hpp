@@ -21,6 +21,7 @@
 
 #include "Calendar.hpp"
 #include "VSOP87.h"
+#include "VSOP87File.hpp"
 
 /*! This structure describes equatorial coordinates. */
 struct EquatorialCoordinates
@@ -86,8 +87,28 @@ enum SolarSystemObjectIndex
     Uranus     = 7,
     Neptune    = 8,
     
-    // Not implemented yet 
-    //EarthsMoon = 9
+    EarthsMoon = 9
+};
+
+/*! This structure describes how light time (planet seen where it was when light left it) is corrected. */
+enum LightTimeMode
+{
+    /*! Series evaluated again at retarded time until it stops changing (up to EPHEMERIS_LIGHT_TIME_ITERATIONS). */
+    LightTimeIterative = 0,
+    
+    /*! One evaluation with velocity, planet moved back along its velocity (EPHEMERIS_LIGHT_TIME_VELOCITY_STEPS cheap steps). */
+    LightTimeVelocity  = 1
+};
+
+/*! This structure describes how many terms of each VSOP87 table are summed for an accuracy target.
+ *  Tables are sorted by decreasing amplitude, so the sum of skipped amplitudes bounds the error. */
+struct VSOP87Truncation
+{
+    /*! Accuracy target in arc seconds. */
+    float accuracy;
+    
+    /*! Number of terms summed by planet, variable (L,B,R) and power of time. */
+    unsigned short count[Neptune+1][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
 };
 
 /*! This structure describes a planet for a specific date and time. */
@@ -106,6 +127,120 @@ struct SolarSystemObject
     float distance;
 };
 
+/*! This structure describes every solar system object for one date and time. */
+struct SolarSystemSnapshot
+{
+    /*! Objects indexed by SolarSystemObjectIndex (Earth has no coordinates). */
+    SolarSystemObject objects[EarthsMoon+1];
+};
+
+/*! This structure describes values shared by every object observed at one date and time. */
+struct EphemerisEpoch
+{
+    /*! Julian day. */
+    JulianDay jd;
+    
+    /*! Julian centuries from J2000. */
+    float T;
+    
+    /*! Earth heliocentric coordinates (NAN if not needed). */
+    HeliocentricCoordinates earth;
+    
+    /*! True obliquity of the ecliptic in floating degrees. */
+    float obliquity;
+    
+    /*! Nutation in obliquity and in longitude in arc seconds. */
+    float deltaObliquity;
+    float deltaNutation;
+    
+    /*! Sun true longitude and true anomaly in floating degrees. */
+    float sunLongitude;
+    float sunAnomaly;
+    
+    /*! Earth orbit eccentricity and perihelion (aberration). */
+    float earthEccentricity;
+    float earthPerihelion;
+    
+    /*! Apparent Greenwich sidereal time in floating hours. */
+    float apparentSiderealTime;
+};
+
+/*! This structure describes values changing over hours or more, kept for nearby epochs (see EphemerisContext::setEpochCacheWindow). */
+struct EphemerisSlowTerms
+{
+    /*! Window and time (Julian centuries) values were computed for, NAN if empty. */
+    float window;
+    float T;
+    
+    /*! True obliquity of the ecliptic in floating degrees and nutation in obliquity and longitude in arc seconds. */
+    float obliquity;
+    float deltaObliquity;
+    float deltaNutation;
+    
+    /*! Earth orbit eccentricity and perihelion. */
+    float earthEccentricity;
+    float earthPerihelion;
+};
+
+/*!
+ * This class describes everything computations depend on: observer location, accuracy target, light
+ * time correction and caches.
+ *
+ * A context is a plain value (copy it freely). Computations only read or update the context they are
+ * given, so threads using their own context run concurrently without any lock. Functions without context
+ * use a default context, set by the static setters of Ephemeris (see Ephemeris::defaultContext).
+ * Truncation is computed for the tables in use: call setAccuracy again after loading a coefficient file
+ * (the default context is updated by Ephemeris::loadVSOP87File).
+ */
+class EphemerisContext
+{
+public:
+    
+    /*! Create a context without location on earth, summing every term, with iterative light time and no epoch cache window. */
+    EphemerisContext();
+    
+    /*! Set location on earth (used for horizontal coordinates conversion). */
+    void setLocationOnEarth(float floatingLatitude, float floatingLongitude);
+    
+    /*! Set location on earth (used for horizontal coordinates conversion). */
+    void setLocationOnEarth(float latDegrees, float latMinutes, float latSeconds,
+                            float lonDegrees, float lonMinutes, float lonSeconds);
+    
+    /*! Set accuracy target in arc seconds for VSOP87 series (see Ephemeris::setAccuracy). */
+    void setAccuracy(float arcseconds);
+    
+    /*! Set light time correction of planets (see Ephemeris::setLightTimeMode). */
+    void setLightTimeMode(LightTimeMode mode);
+    
+    /*! Set validity window in minutes of nutation, obliquity and Earth orbit (see Ephemeris::setEpochCacheWindow). */
+    void setEpochCacheWindow(float minutes);
+    
+    /*! Get truncation for accuracy target (NULL when every term is summed). */
+    const VSOP87Truncation *truncation() const;
+    
+private:
+    
+    friend class Ephemeris;
+    friend class EphemerisEvents;
+    friend class StarCatalogSoA;
+    
+    /*! Observer's coordinates on Earth in floating degrees (NAN if not set). */
+    float latitude;
+    float longitude;
+    
+    /*! Number of terms summed for accuracy target (accuracy 0: every term). */
+    VSOP87Truncation accuracyTruncation;
+    
+    /*! Light time correction of planets. */
+    LightTimeMode lightTimeMode;
+    
+    /*! Validity window of slow terms in Julian centuries (0: identical epochs only). */
+    float slowTermsWindow;
+    
+    /*! Nutation, obliquity and Earth orbit of last epoch. */
+    EphemerisSlowTerms slowTerms;
+};
+
 /*! This structure describes planetary orbit. */
 struct PlanetayOrbit
 {
@@ -142,10 +277,10 @@ class Ephemeris
     
 public:
     
-    /*! Set location on earth (used for horizontal coordinates conversion). */
+    /*! Set location on earth of default context (used for horizontal coordinates conversion). */
     static void setLocationOnEarth(float floatingLatitude, float floatingLongitude);
     
-    /*! Set location on earth (used for horizontal coordinates conversion). */
+    /*! Set location on earth of default context (used for horizontal coordinates conversion). */
     static void setLocationOnEarth(float latDegrees, float latMinutes, float latSeconds,
                                    float lonDegrees, float lonMinutes, float lonSeconds);
     
@@ -162,7 +297,43 @@ public:
     
     /*! Convert integer degrees, minutes, seconds to floating degrees. */
     static float degreesMinutesSecondsToFloatingDegrees(int degrees, int minutes, float seconds);
-
+    
+    
+    
+    /*! Set accuracy target of default context in arc seconds for VSOP87 series (0 to always sum every term).
+     *  Heliocentric longitude and latitude stay within target (radius within the same relative error)
+     *  between 1800 and 2200. Geocentric error of Mercury, Venus and Mars can be up to 3 times larger
+     *  near inferior conjunction or opposition. An arc minute target sums about 1/4 of the terms.
+     *  Target bounds truncation error only: single precision evaluation error adds to it (up to about
+     *  225 arc seconds for Mercury at 2 centuries from J2000, even when every term is summed). */
+    static void setAccuracy(float arcseconds);
+    
+    /*! Compute VSOP87 truncation for an accuracy target in arc seconds (see VSOP87_TRUNCATION_TAU). */
+    static void vsop87TruncationForAccuracy(float arcseconds, VSOP87Truncation *truncation);
+    
+    /*! Set light time correction of planets for default context (LightTimeIterative by default).
+     *  LightTimeVelocity costs one series evaluation per planet instead of two or three. Neglected
+     *  acceleration during light time stays below 0.01 arc second, and light time is not rounded to the
+     *  float resolution of T (LightTimeIterative rounds retarded T to about a minute around 2000, which
+     *  moves Mercury by up to 7 arc seconds, 40 around 1900). */
+    static void setLightTimeMode(LightTimeMode mode);
+    
+    /*! Set validity window of default context in minutes of nutation, obliquity and Earth orbit eccentricity and perihelion
+     *  (0 by default: values are only reused for the same epoch). These values are computed once at the
+     *  center of each window and reused by every epoch inside it (results do not depend on call order).
+     *  Nutation changes by less than 0.2 arc second per day: a 60 minutes window stays within 0.005 arc
+     *  second (coordinates still move by their single precision rounding, up to 0.2 arc second). */
+    static void setEpochCacheWindow(float minutes);
+    
+#if EPHEMERIS_USE_VSOP87_FILE
+    /*! Compute planets found in a coefficient file (see VSOP87File.hpp) instead of VSOP87.h, with current accuracy target.
+     *  Return false if file can not be mapped or is not valid (VSOP87.h stays in use). */
+    static bool loadVSOP87File(const char *path);
+    
+    /*! Compute every planet from VSOP87.h again. */
+    static void unloadVSOP87File();
+#endif
+    
     
     
     /*! Compute solar system object for a specific date, time and location on earth (if location has been initialized first). */
@@ -170,16 +341,121 @@ public:
                                                             unsigned int day,  unsigned int month,  unsigned int year,
                                                             unsigned int hours, unsigned int minutes, unsigned int seconds);
     
+    /*! Compute every solar system object for a specific date, time and location on earth (if location has been initialized first).
+     *  Earth position, nutation, aberration and sidereal time are computed once for all objects. */
+    static SolarSystemSnapshot solarSystemSnapshotAtDateAndTime(unsigned int day,  unsigned int month,  unsigned int year,
+                                                                unsigned int hours, unsigned int minutes, unsigned int seconds);
+    
+    /*! Compute solar system object for a specific date and time with observer and settings of a context. */
+    static SolarSystemObject solarSystemObjectAtDateAndTime(EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                            unsigned int day,  unsigned int month,  unsigned int year,
+                                                            unsigned int hours, unsigned int minutes, unsigned int seconds);
+    
+    /*! Compute every solar system object for a specific date and time with observer and settings of a context. */
+    static SolarSystemSnapshot solarSystemSnapshotAtDateAndTime(EphemerisContext *context,
+                                                                unsigned int day,  unsigned int month,  unsigned int year,
+                                                                unsigned int hours, unsigned int minutes, unsigned int seconds);
+    
+    /*! Compute solar system object for a Julian day (no calendar conversion) and location on earth of default context. */
+    static SolarSystemObject solarSystemObjectAtJulianDay(SolarSystemObjectIndex planet, JulianDay jd);
+    
+    /*! Compute solar system object for a Julian day (no calendar conversion) with observer and settings of a context. */
+    static SolarSystemObject solarSystemObjectAtJulianDay(EphemerisContext *context, SolarSystemObjectIndex planet, JulianDay jd);
+    
+    /*! Compute every solar system object for a Julian day (no calendar conversion) and location on earth of default context. */
+    static SolarSystemSnapshot solarSystemSnapshotAtJulianDay(JulianDay jd);
+    
+    /*! Compute every solar system object for a Julian day (no calendar conversion) with observer and settings of a context. */
+    static SolarSystemSnapshot solarSystemSnapshotAtJulianDay(EphemerisContext *context, JulianDay jd);
+    
+    /*! Compute solar system object for a Julian date (see Calendar::julianDayForJulianDate) and location on earth of default context. */
+    static SolarSystemObject solarSystemObjectAtJulianDate(SolarSystemObjectIndex planet, double julianDate);
+    
+    /*! Compute solar system object for a Julian date (see Calendar::julianDayForJulianDate) with observer and settings of a context. */
+    static SolarSystemObject solarSystemObjectAtJulianDate(EphemerisContext *context, SolarSystemObjectIndex planet, double julianDate);
+    
+    /*! Compute solar system object for T in Julian centuries from J2000 and location on earth of default context.
+     *  T is double precision for sidereal time: single precision T only resolves 90 seconds in 2025. */
+    static SolarSystemObject solarSystemObjectAtT(SolarSystemObjectIndex planet, double T);
+    
+    /*! Compute solar system object for T in Julian centuries from J2000 with observer and settings of a context. */
+    static SolarSystemObject solarSystemObjectAtT(EphemerisContext *context, SolarSystemObjectIndex planet, double T);
+    
+    /*! Get Julian day for T in Julian centuries from J2000. */
+    static JulianDay julianDayForT(double T);
+    
+    /*! Compute apparent sidereal time at Greenwich in floating hours (mean time plus nutation) for a Julian day,
+     *  with nutation cache of default context. */
+    static float apparentSiderealTimeForJulianDay(JulianDay jd);
+    
+    /*! Compute apparent sidereal time at Greenwich in floating hours (mean time plus nutation) for a Julian day,
+     *  with nutation cache of a context. */
+    static float apparentSiderealTimeForJulianDay(EphemerisContext *context, JulianDay jd);
+    
+    /*! Get context used by functions without context (not reentrant, see EphemerisContext). */
+    static EphemerisContext *defaultContext();
+    
+    /*! Compute heliocentric coordinates (VSOP87) for T in Julian centuries from J2000. */
+    static HeliocentricCoordinates heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T);
+    
+    /*! Compute geometric geocentric ecliptic coordinates of the Moon (mean equinox of date, floating degrees)
+     *  and distance in kilometers, from the 60+60 largest ELP-2000/82 terms (10 arc seconds).
+     *  Reference: Chapter 47: Position de la Lune. */
+    static GeocentricCoordinates geocentricCoordinatesForMoon(JulianDay jd, float *distance);
+    
+    /*! Compute heliocentric coordinates (VSOP87) for T with accuracy target of a context. */
+    static HeliocentricCoordinates heliocentricCoordinatesForPlanetAndT(const EphemerisContext *context, SolarSystemObjectIndex planet, float T);
+    
+    /*! Compute heliocentric coordinates (VSOP87) for T with truncated series (NULL for every term). */
+    static HeliocentricCoordinates heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T,
+                                                                        const VSOP87Truncation *truncation);
+    
+    /*! Compute heliocentric coordinates (VSOP87) and velocity for T in Julian centuries from J2000.
+     *  Series are differentiated term by term: one pass over the tables, one sine and cosine per term.
+     *  Velocity is in floating degrees per day for longitude and latitude, AU per day for radius. */
+    static HeliocentricCoordinates heliocentricCoordinatesAndVelocityForPlanetAndT(SolarSystemObjectIndex planet, float T,
+                                                                                   HeliocentricCoordinates *velocity);
+    
+    /*! Compute heliocentric coordinates (VSOP87) and velocity for T with accuracy target of a context. */
+    static HeliocentricCoordinates heliocentricCoordinatesAndVelocityForPlanetAndT(const EphemerisContext *context,
+                                                                                   SolarSystemObjectIndex planet, float T,
+                                                                                   HeliocentricCoordinates *velocity);
+    
+    /*! Compute heliocentric coordinates (VSOP87) and velocity for T with truncated series (NULL for every term). */
+    static HeliocentricCoordinates heliocentricCoordinatesAndVelocityForPlanetAndT(SolarSystemObjectIndex planet, float T,
+                                                                                   const VSOP87Truncation *truncation,
+                                                                                   HeliocentricCoordinates *velocity);
+    
+    /*! Compute heliocentric coordinates (VSOP87) for count values of T (Julian centuries from J2000) in one call. */
+    static void heliocentricCoordinatesForPlanetAndTimes(SolarSystemObjectIndex planet, const float *T, int count,
+                                                         HeliocentricCoordinates *coordinates);
+    
+    /*! Compute heliocentric coordinates (VSOP87) for count values of T with accuracy target of a context. */
+    static void heliocentricCoordinatesForPlanetAndTimes(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                         const float *T, int count, HeliocentricCoordinates *coordinates);
+    
+    /*! Get VSOP87 tables of a planet (false if object has no VSOP87 tables). */
+    static bool vsop87SeriesForPlanet(SolarSystemObjectIndex planet, VSOP87PlanetSeries *planetSeries);
+    
+    /*! Compute heliocentric coordinates from VSOP87 sums (by variable and power of time) for T in thousands of Julian years. */
+    static HeliocentricCoordinates heliocentricCoordinatesForVSOP87Sums(const float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT], float T);
+    
+    /*! Compute heliocentric coordinates and velocity (see heliocentricCoordinatesAndVelocityForPlanetAndT) from VSOP87 sums
+     *  and their derivatives (sums of -A*C*sin(B+C*T)) for T in thousands of Julian years. */
+    static HeliocentricCoordinates heliocentricCoordinatesForVSOP87SumsAndRates(const float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT],
+                                                                                const float rates[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT],
+                                                                                float T, HeliocentricCoordinates *velocity);
+    
 private:
     
+    friend class EphemerisEvents;
+    friend class StarCatalogSoA;
+    
     /*! Compute apparent sideral time (in floating hours) for a given date and time.
      *  Reference: Chapter 7, page 35: Temps sidéral à Greenwich. */
     static float apparentSideralTime(unsigned int day,   unsigned int month,   unsigned int year,
                                      unsigned int hours, unsigned int minutes, unsigned int seconds);
     
-    /*! Compute heliocentric coordinates. */
-    static HeliocentricCoordinates heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T);
-    
     /*! Compute Kepler equation. */
     static float kepler(float M, float e);
     
@@ -192,8 +468,8 @@ private:
     /*! Convert heliocentric coordinates to rectangular coordinates. */
     static RectangularCoordinates HeliocentricToRectangular(HeliocentricCoordinates hc, HeliocentricCoordinates hc0);
     
-    static float meanGreenwichSiderealTimeAtDateAndTime(unsigned int day,   unsigned int month,   unsigned int year,
-                                                        unsigned int hours, unsigned int minutes, unsigned int seconds);
+    /*! Compute mean sidereal time at Greenwich in floating hours, from midnight of Julian day plus time of day. */
+    static float meanGreenwichSiderealTimeForJulianDay(JulianDay jd);
     
     /*! Compute the true obliquity (angle in floating degrees) of the ecliptic,
      *  obliquity, delta obliquity and delta nutation for T.
@@ -203,17 +479,61 @@ private:
     /*! Compute planet informations for T. */
     static PlanetayOrbit planetayOrbitForPlanetAndT(SolarSystemObjectIndex planet, float T);
     
-    /*! Compute sun coordinates in the sky (R.A.,Dec) for a specific date and time.
+    /*! Compute values shared by every object for a specific date and time (Earth position only if needed). */
+    static void epochForDateAndTime(EphemerisContext *context,
+                                    unsigned int day,   unsigned int month,   unsigned int year,
+                                    unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                    bool withEarth, EphemerisEpoch *epoch);
+    
+    /*! Compute values shared by every object for a Julian day (Earth position only if needed). */
+    static void epochForJulianDay(EphemerisContext *context, JulianDay jd, bool withEarth, EphemerisEpoch *epoch);
+    
+    /*! Compute solar system object for an epoch and location on earth of a context (if location has been initialized first). */
+    static SolarSystemObject solarSystemObjectForEpoch(const EphemerisContext *context, SolarSystemObjectIndex planet, const EphemerisEpoch *epoch);
+    
+    /*! Compute sun coordinates in the sky (R.A.,Dec) for an epoch.
      *  Reference: Chapter 16, page 63: Les coordonnées du soleil. */
-    static EquatorialCoordinates equatorialCoordinatesForSunAtJD(JulianDay jd, float *distance, GeocentricCoordinates *gCoordinates);
+    static EquatorialCoordinates equatorialCoordinatesForSunAtEpoch(const EphemerisEpoch *epoch, float *distance, GeocentricCoordinates *gCoordinates);
+    
+    /*! Compute Moon coordinates in the sky (R.A.,Dec) and distance in astronomical units for an epoch. */
+    static EquatorialCoordinates equatorialCoordinatesForMoonAtEpoch(const EphemerisEpoch *epoch, float *distance);
     
-    /*! Compute equatorial coordinates (and geocentric if needed) for a a specific Julian day. */
-    static EquatorialCoordinates equatorialCoordinatesForPlanetAtJD(SolarSystemObjectIndex planet, JulianDay jd,
-                                                                    float *distance, GeocentricCoordinates *gCoordinates);
+    /*! Compute equatorial coordinates (and geocentric if needed) for an epoch. */
+    static EquatorialCoordinates equatorialCoordinatesForPlanetAtEpoch(const EphemerisContext *context, SolarSystemObjectIndex planet, const EphemerisEpoch *epoch,
+                                                                       float *distance, GeocentricCoordinates *gCoordinates);
     
-    /*! Compute VSOP87 coefficients for T. */
+    /*! Compute VSOP87 coefficients for T (scalar reference implementation). */
     static float sumVSOP87Coefs(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, float T);
     
+    /*! Compute first termCount VSOP87 coefficients of a table for T with the fastest available kernel (see VSOP87SoA.hpp). */
+    static float sumVSOP87Series(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, int termCount, float T);
+    
+    /*! Compute VSOP87 coefficients and their derivative for T (scalar reference implementation). */
+    static float sumVSOP87CoefsAndRate(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, float T, float *rate);
+    
+    /*! Compute first termCount VSOP87 coefficients of a table and their derivative for T with the fastest available kernel. */
+    static float sumVSOP87SeriesAndRate(const VSOP87Coefficient *valuePlanetCoefficients, int coefCount, int termCount, float T, float *rate);
+    
+    /*! Compute one VSOP87 table of a planet for T (table resolved at compile time). */
+    template<int planet, int variable, int power>
+    static float sumVSOP87SeriesForPlanet(float T, const VSOP87Truncation *truncation);
+    
+#if EPHEMERIS_USE_VSOP87_FILE
+    /*! Compute heliocentric coordinates of a planet for T from coefficient file. */
+    static HeliocentricCoordinates heliocentricCoordinatesFromVSOP87File(SolarSystemObjectIndex planet, float T,
+                                                                         const VSOP87Truncation *truncation);
+#endif
+    
+    /*! Number of terms of a VSOP87 table in use (coefficient file or VSOP87.h). */
+    static int vsop87TermCountForPlanet(SolarSystemObjectIndex planet, int variable, int power);
+    
+    /*! Amplitude (1e-8 radian or AU) of a term of a VSOP87 table in use (coefficient file or VSOP87.h). */
+    static float vsop87AmplitudeForPlanet(SolarSystemObjectIndex planet, int variable, int power, int term);
+    
+    /*! Compute heliocentric coordinates of a planet for T (every table unrolled). */
+    template<int planet>
+    static HeliocentricCoordinates heliocentricCoordinatesForT(float T, const VSOP87Truncation *truncation);
+    
 };
 
 #endif
@@ -0,0 +1,669 @@
+/*
+ * EphemerisEvents.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+
+#include <math.h>
+
+#include "EphemerisEvents.hpp"
+#include "EphemerisRange.hpp"
+#include "RootFinding.hpp"
+#include "FastMath.hpp"
+
+#if EPHEMERIS_USE_THREADS
+#include <thread>
+#include <atomic>
+#include <vector>
+#endif
+
+#define SECONDS_PER_DAY 86400
+
+// Number of sample intervals of a day (EPHEMERIS_EVENTS_GRID_MINUTES must divide a day)
+#define EVENTS_GRID_COUNT (1440/EPHEMERIS_EVENTS_GRID_MINUTES)
+
+// Maximum evaluations of one refinement (Brent converges in less than 10 for 1 second)
+#define EVENTS_MAX_EVALUATIONS 30
+
+// Julian day of J2000
+#define J2000 2451545.0
+
+// Number of planetary event functions (see PlanetaryEventState)
+#define PLANETARY_FUNCTION_COUNT 5
+
+// Smallest step of planetary event search in days
+#define PLANETARY_MIN_STEP 0.5
+
+/*! This structure describes altitude or hour angle of an object as a function of seconds of a day. */
+struct EphemerisEventFunction
+{
+    EphemerisContext       *context;
+    SolarSystemObjectIndex  planet;
+    unsigned int            day, month, year;
+    float                   horizonAltitude;
+    
+    /*! Hour angle instead of altitude. */
+    bool                    hourAngle;
+    
+    float operator()(float seconds)
+    {
+        float altitude, H;
+        EphemerisEvents::altitudeAndHourAngleForSeconds(context, planet, day, month, year, seconds, horizonAltitude,
+                                                        &altitude, &H);
+        return hourAngle ? H : altitude;
+    }
+};
+
+// Refine root of function in [a,b] (values of opposite signs), starting with an interpolated estimate (NAN if none)
+static float refineEvent(EphemerisEventFunction *function, float a, float b, float fa, float fb, float estimate)
+{
+    if( !isnan(estimate) && estimate > a+EPHEMERIS_EVENTS_TOLERANCE && estimate < b-EPHEMERIS_EVENTS_TOLERANCE )
+    {
+        // Keep half of the bracket containing the root
+        float fe = (*function)(estimate);
+        if( fe == 0 )
+        {
+            return estimate;
+        }
+        
+        if( (fe < 0) == (fa < 0) )
+        {
+            a  = estimate;
+            fa = fe;
+        }
+        else
+        {
+            b  = estimate;
+            fb = fe;
+        }
+    }
+    
+    return brentRoot(function, a, b, fa, fb, EPHEMERIS_EVENTS_TOLERANCE, EVENTS_MAX_EVALUATIONS);
+}
+
+// Record a horizon crossing in [a,b] as rise or set (first one of each kept)
+static void refineHorizonCrossing(EphemerisEventFunction *function, float a, float b, float fa, float fb, float estimate,
+                                  RiseTransitSet *events)
+{
+    float *time = fa < 0 ? &events->rise : &events->set;
+    if( isnan(*time) )
+    {
+        *time = refineEvent(function, a, b, fa, fb, estimate)/3600;
+    }
+}
+
+void EphemerisEvents::altitudeAndHourAngleForSeconds(EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                     unsigned int day, unsigned int month, unsigned int year,
+                                                     float seconds, float horizonAltitude,
+                                                     float *altitude, float *hourAngle)
+{
+    // Whole seconds (24h is accepted as time of day)
+    long time = (long)(seconds+0.5);
+    time = time < 0 ? 0 : (time > SECONDS_PER_DAY ? SECONDS_PER_DAY : time);
+    
+    EphemerisEpoch epoch;
+    Ephemeris::epochForDateAndTime(context, day, month, year, time/3600, time/60%60, time%60, planet != Sun, &epoch);
+    
+    SolarSystemObject object = Ephemeris::solarSystemObjectForEpoch(context, planet, &epoch);
+    
+    *altitude = object.horiCoordinates.alt - horizonAltitude;
+    
+    // Local hour angle in [-180,180[
+    float H = (epoch.apparentSiderealTime - context->longitude/15 - object.equaCoordinates.ra)*15;
+    *hourAngle = H - 360*floor((H+180)/360);
+}
+
+RiseTransitSet EphemerisEvents::riseTransitSetForDate(SolarSystemObjectIndex planet,
+                                                      unsigned int day, unsigned int month, unsigned int year,
+                                                      float horizonAltitude)
+{
+    return riseTransitSetForDate(Ephemeris::defaultContext(), planet, day, month, year, horizonAltitude);
+}
+
+RiseTransitSet EphemerisEvents::riseTransitSetForDate(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                      unsigned int day, unsigned int month, unsigned int year,
+                                                      float horizonAltitude)
+{
+    RiseTransitSet events = {NAN, NAN, NAN, NAN};
+    
+    if( isnan(context->latitude) || isnan(context->longitude) || planet == Earth )
+    {
+        return events;
+    }
+    
+    // Private caches
+    EphemerisContext workContext = *context;
+    
+    EphemerisEventFunction altitudeFunction  = {&workContext, planet, day, month, year, horizonAltitude, false};
+    EphemerisEventFunction hourAngleFunction = {&workContext, planet, day, month, year, horizonAltitude, true};
+    
+    // Coarse samples
+    float step = EPHEMERIS_EVENTS_GRID_MINUTES*60.0f;
+    float altitudes[EVENTS_GRID_COUNT+1];
+    float hourAngles[EVENTS_GRID_COUNT+1];
+    for(int sample=0; sample<=EVENTS_GRID_COUNT; sample++)
+    {
+        altitudeAndHourAngleForSeconds(&workContext, planet, day, month, year, sample*step, horizonAltitude,
+                                       &altitudes[sample], &hourAngles[sample]);
+    }
+    
+    for(int interval=0; interval<EVENTS_GRID_COUNT; interval++)
+    {
+        float a  = interval*step;
+        float b  = a+step;
+        float fa = altitudes[interval];
+        float fb = altitudes[interval+1];
+        
+        // Quadratic through three samples around interval (n in steps from central sample)
+        int   center = interval == 0 ? 1 : interval;
+        float nMin   = interval-center;
+        float y0 = altitudes[center-1];
+        float y1 = altitudes[center];
+        float y2 = altitudes[center+1];
+        
+        if( (fa < 0) != (fb < 0) )
+        {
+            // Horizon crossed once
+            float n = quadraticRoot(y0, y1, y2, nMin, nMin+1);
+            refineHorizonCrossing(&altitudeFunction, a, b, fa, fb, (center+n)*step, &events);
+        }
+        else
+        {
+            // Rise and set between two samples on the same side of horizon (object grazing horizon)
+            float extremum;
+            float n = quadraticExtremum(y0, y1, y2, &extremum);
+            if( !isnan(n) && n > nMin && n < nMin+1 && (extremum < 0) != (fa < 0) )
+            {
+                float middle  = (center+n)*step;
+                float fMiddle = altitudeFunction(middle);
+                if( (fMiddle < 0) != (fa < 0) )
+                {
+                    refineHorizonCrossing(&altitudeFunction, a, middle, fa, fMiddle, NAN, &events);
+                    refineHorizonCrossing(&altitudeFunction, middle, b, fMiddle, fb, NAN, &events);
+                }
+            }
+        }
+        
+        // Transit: hour angle goes through 0 (and not through 180)
+        float Ha = hourAngles[interval];
+        float Hb = hourAngles[interval+1];
+        if( isnan(events.transit) && Ha < 0 && Hb >= 0 && Hb-Ha < 180 )
+        {
+            float transit = refineEvent(&hourAngleFunction, a, b, Ha, Hb, a-Ha/(Hb-Ha)*step);
+            
+            events.transit         = transit/3600;
+            events.transitAltitude = altitudeFunction(transit) + horizonAltitude;
+        }
+    }
+    
+    return events;
+}
+
+/*! This structure describes geometric values of a planet whose roots are planetary events. */
+struct PlanetaryEventState
+{
+    /*! Event functions: longitude difference with the Sun (and opposite of the Sun) in [-180,180[,
+     *  derivative of cosine of elongation, geocentric longitude rate, heliocentric distance rate. */
+    float functions[PLANETARY_FUNCTION_COUNT];
+    
+    /*! Elongation and geocentric longitude in floating degrees, distances in AU. */
+    float elongation;
+    float longitude;
+    float radius;
+    float distance;
+    float sunDistance;
+};
+
+// Event functions (index in PlanetaryEventState::functions)
+enum PlanetaryEventFunction
+{
+    ConjunctionFunction = 0,
+    OppositionFunction,
+    ElongationFunction,
+    StationaryFunction,
+    PerihelionFunction
+};
+
+// Largest step in days (half the shortest time between two roots of one function)
+static const float planetaryMaxSteps[Neptune+1] = {0, 8, 20, 30, 20, 30, 30, 30, 30};
+
+// Heliocentric rectangular ecliptic coordinates and velocity (per day)
+static void rectangularAndVelocity(HeliocentricCoordinates position, HeliocentricCoordinates velocity,
+                                   float rectangular[3], float rate[3])
+{
+    float sinL, cosL, sinB, cosB;
+    fastSinCosDegrees<float,int>(position.lon, &sinL, &cosL);
+    fastSinCosDegrees<float,int>(position.lat, &sinB, &cosB);
+    
+    float r  = position.radius;
+    float dL = velocity.lon*FAST_MATH_PI_OVER_180;
+    float dB = velocity.lat*FAST_MATH_PI_OVER_180;
+    float dR = velocity.radius;
+    
+    rectangular[0] = r*cosB*cosL;
+    rectangular[1] = r*cosB*sinL;
+    rectangular[2] = r*sinB;
+    
+    rate[0] = dR*cosB*cosL - r*sinB*dB*cosL - r*cosB*sinL*dL;
+    rate[1] = dR*cosB*sinL - r*sinB*dB*sinL + r*cosB*cosL*dL;
+    rate[2] = dR*sinB      + r*cosB*dB;
+}
+
+// Wrap angle in floating degrees to [-180,180[
+static inline float wrapDegrees(float angle)
+{
+    return angle - 360*floor((angle+180)/360);
+}
+
+// Compute event functions of a planet at Julian day
+static void planetaryEventStateForJulianDay(const EphemerisContext *context, SolarSystemObjectIndex planet, double jd,
+                                            PlanetaryEventState *state)
+{
+    float T = (float)((jd-J2000)/36525);
+    
+    HeliocentricCoordinates planetVelocity, earthVelocity;
+    HeliocentricCoordinates planetPosition = Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(context, planet, T, &planetVelocity);
+    
+    state->radius = planetPosition.radius;
+    state->functions[PerihelionFunction] = planetVelocity.radius;
+    
+    if( planet == Earth )
+    {
+        // Heliocentric events only
+        for(int function=ConjunctionFunction; function<PerihelionFunction; function++)
+        {
+            state->functions[function] = 0;
+        }
+        state->elongation  = NAN;
+        state->longitude   = NAN;
+        state->distance    = 0;
+        state->sunDistance = planetPosition.radius;
+        return;
+    }
+    
+    HeliocentricCoordinates earthPosition = Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT(context, Earth, T, &earthVelocity);
+    
+    float p[3], dp[3], e[3], de[3];
+    rectangularAndVelocity(planetPosition, planetVelocity, p, dp);
+    rectangularAndVelocity(earthPosition,  earthVelocity,  e, de);
+    
+    // Geocentric planet (g) and Sun (s = -e)
+    float g[3], dg[3];
+    for(int axis=0; axis<3; axis++)
+    {
+        g[axis]  = p[axis]-e[axis];
+        dg[axis] = dp[axis]-de[axis];
+    }
+    
+    float planetXY2 = g[0]*g[0]+g[1]*g[1];
+    float sunXY2    = e[0]*e[0]+e[1]*e[1];
+    
+    // Geocentric longitudes and rates (radians per day)
+    float lambda        = atan2f(g[1], g[0])*FAST_MATH_180_OVER_PI;
+    float sunLambda     = atan2f(-e[1], -e[0])*FAST_MATH_180_OVER_PI;
+    float lambdaRate    = (g[0]*dg[1]-g[1]*dg[0])/planetXY2;
+    
+    state->longitude = lambda < 0 ? lambda+360 : lambda;
+    
+    state->functions[ConjunctionFunction] = wrapDegrees(lambda-sunLambda);
+    state->functions[OppositionFunction]  = wrapDegrees(lambda-sunLambda-180);
+    state->functions[StationaryFunction]  = lambdaRate*FAST_MATH_180_OVER_PI;
+    
+    // Elongation E: cos(E) = g.s/(|g||s|) and its derivative
+    float gs      = -(g[0]*e[0]+g[1]*e[1]+g[2]*e[2]);
+    float dgs     = -(dg[0]*e[0]+dg[1]*e[1]+dg[2]*e[2]) - (g[0]*de[0]+g[1]*de[1]+g[2]*de[2]);
+    float gNorm   = sqrtf(planetXY2+g[2]*g[2]);
+    float sNorm   = sqrtf(sunXY2+e[2]*e[2]);
+    float dgNorm  = (g[0]*dg[0]+g[1]*dg[1]+g[2]*dg[2])/gNorm;
+    float dsNorm  = (e[0]*de[0]+e[1]*de[1]+e[2]*de[2])/sNorm;
+    float product = gNorm*sNorm;
+    
+    float cosE = gs/product;
+    cosE = cosE > 1 ? 1 : (cosE < -1 ? -1 : cosE);
+    
+    state->elongation  = acosf(cosE)*FAST_MATH_180_OVER_PI;
+    state->distance    = gNorm;
+    state->sunDistance = sNorm;
+    state->functions[ElongationFunction] = (dgs*product - gs*(dgNorm*sNorm + gNorm*dsNorm))/(product*product);
+}
+
+/*! This structure describes one event function of a planet as a function of days from a Julian day. */
+struct PlanetaryEventFunctionOfTime
+{
+    const EphemerisContext *context;
+    SolarSystemObjectIndex  planet;
+    double                  jd0;
+    int                     function;
+    
+    float operator()(float days)
+    {
+        PlanetaryEventState state;
+        planetaryEventStateForJulianDay(context, planet, jd0+days, &state);
+        return state.functions[function];
+    }
+};
+
+/*! This structure receives events of a search (stored up to capacity, every event counted). */
+struct PlanetaryEventSink
+{
+    PlanetaryEvent *events;
+    long            capacity;
+    long            count;
+    
+    void add(const PlanetaryEvent *event)
+    {
+        if( count < capacity )
+        {
+            events[count] = *event;
+        }
+        count++;
+    }
+};
+
+#if EPHEMERIS_USE_THREADS
+/*! This structure receives events of one window of a parallel search. */
+struct PlanetaryEventVector
+{
+    std::vector<PlanetaryEvent> events;
+    
+    void add(const PlanetaryEvent *event)
+    {
+        events.push_back(*event);
+    }
+};
+#endif
+
+// Event types of functions whose sign change goes up (negative to positive) or down
+static const int planetaryRisingTypes[PLANETARY_FUNCTION_COUNT]  = {ConjunctionEvent, OppositionEvent, GreatestEasternElongationEvent,
+                                                                    StationaryDirectEvent, PerihelionEvent};
+static const int planetaryFallingTypes[PLANETARY_FUNCTION_COUNT] = {ConjunctionEvent, OppositionEvent, -1,
+                                                                    StationaryRetrogradeEvent, AphelionEvent};
+
+// Mask of event types of a function
+static unsigned int planetaryFunctionMask(int function)
+{
+    unsigned int mask = 0;
+    
+    if( planetaryRisingTypes[function] >= 0 )
+    {
+        mask |= 1u << planetaryRisingTypes[function];
+    }
+    
+    if( planetaryFallingTypes[function] >= 0 )
+    {
+        mask |= 1u << planetaryFallingTypes[function];
+    }
+    
+    if( function == ConjunctionFunction )
+    {
+        mask |= 1u << InferiorConjunctionEvent;
+    }
+    
+    if( function == ElongationFunction )
+    {
+        mask |= 1u << GreatestWesternElongationEvent;
+    }
+    
+    return mask;
+}
+
+// Search events of one window [jd0,jd0+days] (events at the very end belong to next window)
+template<typename Sink>
+static void searchPlanetaryEventWindow(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                       double jd0, float days, unsigned int eventMask, Sink *sink)
+{
+    // Functions needed by requested types
+    bool enabled[PLANETARY_FUNCTION_COUNT];
+    for(int function=0; function<PLANETARY_FUNCTION_COUNT; function++)
+    {
+        enabled[function] = (planetaryFunctionMask(function) & eventMask) != 0;
+    }
+    
+    // Angles do not reach conjunction nor elongation extrema seen from the Sun, and only inner planets have elongations
+    if( planet == Earth )
+    {
+        enabled[ConjunctionFunction] = enabled[OppositionFunction] = enabled[ElongationFunction] = enabled[StationaryFunction] = false;
+    }
+    else if( planet <= Venus )
+    {
+        enabled[OppositionFunction] = false;
+    }
+    else
+    {
+        enabled[ElongationFunction] = false;
+    }
+    
+    float maxStep = planetaryMaxSteps[planet];
+    
+    PlanetaryEventState previous;
+    planetaryEventStateForJulianDay(context, planet, jd0, &previous);
+    
+    float t    = 0;
+    float step = PLANETARY_MIN_STEP;
+    
+    while( t < days )
+    {
+        float next = t+step < days ? t+step : days;
+        
+        PlanetaryEventState current;
+        planetaryEventStateForJulianDay(context, planet, jd0+next, &current);
+        
+        // Events found in this step, in chronological order
+        PlanetaryEvent found[PLANETARY_FUNCTION_COUNT];
+        int            foundCount = 0;
+        
+        // Time left before nearest root at current rate
+        float nextStep = maxStep;
+        
+        for(int function=0; function<PLANETARY_FUNCTION_COUNT; function++)
+        {
+            if( !enabled[function] )
+            {
+                continue;
+            }
+            
+            float fa = previous.functions[function];
+            float fb = current.functions[function];
+            
+            // Longitude differences jump from 180 to -180: not a root
+            bool jump = function <= OppositionFunction && fabs(fb-fa) > 180;
+            
+            if( !jump && fb != fa )
+            {
+                float rate = (fb-fa)/(next-t);
+                float left = 0.5f*fabs(fb/rate);
+                nextStep = left < nextStep ? left : nextStep;
+            }
+            
+            if( jump || (fa < 0) == (fb < 0) )
+            {
+                continue;
+            }
+            
+            int type = fa < 0 ? planetaryRisingTypes[function] : planetaryFallingTypes[function];
+            if( type < 0 )
+            {
+                // Smallest elongation (near conjunction)
+                continue;
+            }
+            
+            PlanetaryEventFunctionOfTime functionOfTime = {context, planet, jd0, function};
+            float root = brentRoot(&functionOfTime, t, next, fa, fb, EPHEMERIS_PLANETARY_EVENTS_TOLERANCE, EVENTS_MAX_EVALUATIONS);
+            
+            PlanetaryEventState state;
+            planetaryEventStateForJulianDay(context, planet, jd0+root, &state);
+            
+            float value;
+            if( function == ConjunctionFunction || function == OppositionFunction )
+            {
+                value = state.elongation;
+                if( function == ConjunctionFunction && state.distance < state.sunDistance )
+                {
+                    type = InferiorConjunctionEvent;
+                }
+            }
+            else if( function == ElongationFunction )
+            {
+                value = state.elongation;
+                if( state.functions[ConjunctionFunction] < 0 )
+                {
+                    type = GreatestWesternElongationEvent;
+                }
+            }
+            else if( function == StationaryFunction )
+            {
+                value = state.longitude;
+            }
+            else
+            {
+                value = state.radius;
+            }
+            
+            if( !(eventMask & (1u << type)) )
+            {
+                continue;
+            }
+            
+            double jd = jd0+root;
+            
+            PlanetaryEvent event;
+            event.type     = (PlanetaryEventType)type;
+            event.planet   = planet;
+            event.jd.day   = (long)floor(jd);
+            event.jd.time  = (float)(jd-floor(jd));
+            event.value    = value;
+            
+            // Insertion in chronological order
+            int position = foundCount++;
+            while( position > 0 && (found[position-1].jd.day+(double)found[position-1].jd.time) > jd )
+            {
+                found[position] = found[position-1];
+                position--;
+            }
+            found[position] = event;
+        }
+        
+        for(int numFound=0; numFound<foundCount; numFound++)
+        {
+            sink->add(&found[numFound]);
+        }
+        
+        previous = current;
+        t        = next;
+        step     = nextStep < PLANETARY_MIN_STEP ? PLANETARY_MIN_STEP : nextStep;
+    }
+}
+
+#if EPHEMERIS_USE_THREADS
+// Search windows taken from a shared counter
+static void runPlanetaryEventWorker(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                    double startJD, double endJD, unsigned int eventMask,
+                                    std::atomic<long> *nextWindow, std::vector<PlanetaryEventVector> *windows)
+{
+    for(long window=(*nextWindow)++; window<(long)windows->size(); window=(*nextWindow)++)
+    {
+        double jd0  = startJD + window*(double)EPHEMERIS_PLANETARY_EVENTS_WINDOW;
+        double jd1  = jd0+EPHEMERIS_PLANETARY_EVENTS_WINDOW < endJD ? jd0+EPHEMERIS_PLANETARY_EVENTS_WINDOW : endJD;
+        
+        searchPlanetaryEventWindow(context, planet, jd0, (float)(jd1-jd0), eventMask, &(*windows)[window]);
+    }
+}
+#endif
+
+long EphemerisEvents::planetaryEventsForPlanet(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                               JulianDay start, JulianDay end, unsigned int eventMask,
+                                               PlanetaryEvent *events, long maxEvents, int threadCount)
+{
+    double startJD = start.day + (double)start.time;
+    double endJD   = end.day   + (double)end.time;
+    
+    if( context == NULL || planet <= Sun || planet > Neptune || endJD < startJD || maxEvents < 0 || (maxEvents > 0 && events == NULL) )
+    {
+        return -1;
+    }
+    
+    long windowCount = (long)ceil((endJD-startJD)/EPHEMERIS_PLANETARY_EVENTS_WINDOW);
+    
+    PlanetaryEventSink sink = {events, maxEvents, 0};
+    
+#if EPHEMERIS_USE_THREADS
+    if( threadCount <= 0 )
+    {
+        threadCount = (int)std::thread::hardware_concurrency();
+    }
+    
+    if( threadCount > windowCount )
+    {
+        threadCount = (int)windowCount;
+    }
+    
+    if( threadCount > 1 )
+    {
+        std::vector<PlanetaryEventVector> windows(windowCount);
+        std::atomic<long> nextWindow(0);
+        
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount-1);
+        for(int numThread=1; numThread<threadCount; numThread++)
+        {
+            try
+            {
+                threads.push_back(std::thread(runPlanetaryEventWorker, context, planet, startJD, endJD, eventMask, &nextWindow, &windows));
+            }
+            catch(...)
+            {
+                // Windows are taken by running threads
+                break;
+            }
+        }
+        
+        runPlanetaryEventWorker(context, planet, startJD, endJD, eventMask, &nextWindow, &windows);
+        
+        for(size_t numThread=0; numThread<threads.size(); numThread++)
+        {
+            threads[numThread].join();
+        }
+        
+        // Windows in chronological order
+        for(long window=0; window<windowCount; window++)
+        {
+            for(size_t numEvent=0; numEvent<windows[window].events.size(); numEvent++)
+            {
+                sink.add(&windows[window].events[numEvent]);
+            }
+        }
+        
+        return sink.count;
+    }
+#else
+    (void)threadCount;
+#endif
+    
+    for(long window=0; window<windowCount; window++)
+    {
+        double jd0 = startJD + window*(double)EPHEMERIS_PLANETARY_EVENTS_WINDOW;
+        double jd1 = jd0+EPHEMERIS_PLANETARY_EVENTS_WINDOW < endJD ? jd0+EPHEMERIS_PLANETARY_EVENTS_WINDOW : endJD;
+        
+        searchPlanetaryEventWindow(context, planet, jd0, (float)(jd1-jd0), eventMask, &sink);
+    }
+    
+    return sink.count;
+}
@@ -0,0 +1,156 @@
+/*
+ * EphemerisEvents.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EphemerisEvents_h
+#define EphemerisEvents_h
+
+#include "Ephemeris.hpp"
+
+// Standard horizon altitudes in floating degrees (refraction and, for the Sun and Moon, semi diameter)
+#define EPHEMERIS_HORIZON_SUN    -0.8333
+#define EPHEMERIS_HORIZON_PLANET -0.5667
+#define EPHEMERIS_HORIZON_MOON   -0.8333
+
+// Minutes between altitude samples of a day (refined afterwards, see EphemerisEvents)
+#ifndef EPHEMERIS_EVENTS_GRID_MINUTES
+#define EPHEMERIS_EVENTS_GRID_MINUTES 120
+#endif
+
+// Tolerance in seconds of event times
+#ifndef EPHEMERIS_EVENTS_TOLERANCE
+#define EPHEMERIS_EVENTS_TOLERANCE 1
+#endif
+
+/*! This structure describes rise, transit and set of an object during a day. */
+struct RiseTransitSet
+{
+    /*! Times in floating hours UT from 0h of the day (NAN if event does not happen this day). */
+    float rise;
+    float transit;
+    float set;
+    
+    /*! Altitude at transit in floating degrees. */
+    float transitAltitude;
+};
+
+// Tolerance in days of planetary event times (series are evaluated at single precision T, see PlanetaryEvent)
+#ifndef EPHEMERIS_PLANETARY_EVENTS_TOLERANCE
+#define EPHEMERIS_PLANETARY_EVENTS_TOLERANCE 0.001
+#endif
+
+// Days searched by one task of planetary event search (windows are searched in parallel)
+#ifndef EPHEMERIS_PLANETARY_EVENTS_WINDOW
+#define EPHEMERIS_PLANETARY_EVENTS_WINDOW 4000
+#endif
+
+/*! Planetary events (geometric positions, no light time, aberration nor nutation). */
+enum PlanetaryEventType
+{
+    /*! Geocentric longitude equals Sun's one (superior conjunction for Mercury and Venus). */
+    ConjunctionEvent = 0,
+    
+    /*! Geocentric longitude equals Sun's one, planet between Sun and Earth (Mercury and Venus). */
+    InferiorConjunctionEvent,
+    
+    /*! Geocentric longitude opposite to Sun's one (Mars to Neptune). */
+    OppositionEvent,
+    
+    /*! Largest angular distance to the Sun, east or west of the Sun (Mercury and Venus). */
+    GreatestEasternElongationEvent,
+    GreatestWesternElongationEvent,
+    
+    /*! Geocentric longitude starts decreasing (retrograde motion) or increasing again. */
+    StationaryRetrogradeEvent,
+    StationaryDirectEvent,
+    
+    /*! Heliocentric distance is minimum or maximum (Earth included). */
+    PerihelionEvent,
+    AphelionEvent
+};
+
+// Mask of every planetary event type
+#define PLANETARY_EVENTS_ALL 0x1FF
+
+/*! This structure describes a planetary event. */
+struct PlanetaryEvent
+{
+    PlanetaryEventType      type;
+    SolarSystemObjectIndex  planet;
+    
+    /*! Date and time of event (UT assumed equal to dynamical time), within about a minute. */
+    JulianDay               jd;
+    
+    /*! Elongation in floating degrees (conjunction, opposition, elongation), geocentric longitude in
+     *  floating degrees (stationary points) or heliocentric distance in AU (perihelion, aphelion). */
+    float                   value;
+};
+
+/*!
+ * This class finds rise, transit and set times.
+ *
+ * Altitude and hour angle are sampled every EPHEMERIS_EVENTS_GRID_MINUTES over the day. Intervals
+ * where they change sign (or where a quadratic through neighbouring samples dips across the horizon)
+ * are narrowed by quadratic interpolation of the samples, then refined with Brent's method down to
+ * EPHEMERIS_EVENTS_TOLERANCE seconds. A day costs about 30 evaluations instead of 1440 for a
+ * minute by minute scan.
+ *
+ * Planetary events are roots of geometric functions computed from heliocentric series and their
+ * analytic derivatives (see Ephemeris::heliocentricCoordinatesAndVelocityForPlanetAndT): longitude
+ * difference with the Sun (conjunction, opposition), rate of elongation, rate of geocentric longitude
+ * (stationary points) and rate of heliocentric distance (perihelion, aphelion). Steps are scaled by the
+ * time left before the nearest root at current rate, from half a day up to a bound set by the planet's
+ * fastest event pair (Mercury 8 days, outer planets 30), and sign changes are refined with Brent's
+ * method. A century of Jupiter (about 380 events to a minute) costs about 9000 evaluations, most of
+ * them in refinement, where daily sampling would need 36525 evaluations to bracket events to a day.
+ */
+class EphemerisEvents
+{
+public:
+    
+    /*! Compute rise, transit and set during a day (0h to 24h UT) for observer of a context, rise and set
+     *  being when altitude crosses horizonAltitude in floating degrees (see EPHEMERIS_HORIZON_SUN).
+     *  Every time is NAN if context has no location on earth. */
+    static RiseTransitSet riseTransitSetForDate(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                unsigned int day, unsigned int month, unsigned int year,
+                                                float horizonAltitude);
+    
+    /*! Compute rise, transit and set during a day for location on earth of default context. */
+    static RiseTransitSet riseTransitSetForDate(SolarSystemObjectIndex planet,
+                                                unsigned int day, unsigned int month, unsigned int year,
+                                                float horizonAltitude);
+    
+    /*! Find planetary events of types in eventMask (bits 1<<PlanetaryEventType) between two dates, in
+     *  chronological order, with accuracy target of a context. Windows of EPHEMERIS_PLANETARY_EVENTS_WINDOW
+     *  days are searched in parallel (threadCount 0 uses every hardware thread), results do not depend on
+     *  thread count. At most maxEvents events are stored, return number of events found (-1 if arguments
+     *  are not valid). */
+    static long planetaryEventsForPlanet(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                         JulianDay start, JulianDay end, unsigned int eventMask,
+                                         PlanetaryEvent *events, long maxEvents, int threadCount = 0);
+    
+    /*! Compute altitude (floating degrees, relative to horizonAltitude) and hour angle (floating degrees
+     *  in [-180,180[) of an object at seconds from 0h UT of a day (at most a day). */
+    static void altitudeAndHourAngleForSeconds(EphemerisContext *context, SolarSystemObjectIndex planet,
+                                               unsigned int day, unsigned int month, unsigned int year,
+                                               float seconds, float horizonAltitude,
+                                               float *altitude, float *hourAngle);
+};
+
+#endif
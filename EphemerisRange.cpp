@@ -0,0 +1,326 @@
+/*
+ * EphemerisRange.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+
+#include <stddef.h>
+
+#include "EphemerisRange.hpp"
+
+#if EPHEMERIS_USE_THREADS
+#include <thread>
+#include <mutex>
+#include <vector>
+#endif
+
+#define SECONDS_PER_DAY 86400
+
+/*! This structure describes one range computation. */
+struct EphemerisRangeTask
+{
+    /*! Observer and settings (copied by each thread). */
+    const EphemerisContext *context;
+    
+    /*! Start date and time. */
+    unsigned int day, month, year;
+    unsigned int hours, minutes, seconds;
+    
+    /*! Seconds between two dates. */
+    unsigned long stepSeconds;
+    
+    /*! Number of dates. */
+    long count;
+    
+    /*! Object computed (objects output) or every object (snapshots output). */
+    SolarSystemObjectIndex planet;
+    SolarSystemObject     *objects;
+    SolarSystemSnapshot   *snapshots;
+};
+
+void EphemerisRange::dateAndTimeForRangeIndex(unsigned int day,    unsigned int month,    unsigned int year,
+                                              unsigned int hours,  unsigned int minutes,  unsigned int seconds,
+                                              unsigned long stepSeconds, long index,
+                                              unsigned int *outDay,   unsigned int *outMonth,   unsigned int *outYear,
+                                              unsigned int *outHours, unsigned int *outMinutes, unsigned int *outSeconds)
+{
+    // Whole seconds from start date at 0h (64 bits: a century of seconds does not fit in 32 bits)
+    unsigned long long totalSeconds = hours*3600ULL + minutes*60ULL + seconds + (unsigned long long)stepSeconds*index;
+    unsigned long long dayOffset    = totalSeconds/SECONDS_PER_DAY;
+    unsigned long      daySeconds   = (unsigned long)(totalSeconds%SECONDS_PER_DAY);
+    
+    // Calendar date of start day plus whole days (time 0.5 is 0h, see Calendar::julianDayForDate)
+    JulianDay jd = Calendar::julianDayForDate(day, month, year);
+    jd.day  += (long)dayOffset;
+    jd.time  = 0.5;
+    
+    float floatingDay;
+    Calendar::dateForJulianDay(jd, &floatingDay, outMonth, outYear);
+    
+    *outDay     = (unsigned int)floatingDay;
+    *outHours   = (unsigned int)(daySeconds/3600);
+    *outMinutes = (unsigned int)(daySeconds/60%60);
+    *outSeconds = (unsigned int)(daySeconds%60);
+}
+
+// Compute output number index of a task
+static void computeRangeIndex(const EphemerisRangeTask *task, EphemerisContext *context, long index)
+{
+    // Whole seconds from noon before start day (same Julian day as Calendar::julianDayForDateAndTime, without date round trip)
+    unsigned long long totalSeconds = task->hours*3600ULL + task->minutes*60ULL + task->seconds + SECONDS_PER_DAY/2
+                                    + (unsigned long long)task->stepSeconds*index;
+    
+    JulianDay jd;
+    jd.day  = Calendar::julianDayNumberForDate(task->day, task->month, task->year) - 1 + (long)(totalSeconds/SECONDS_PER_DAY);
+    jd.time = (float)(totalSeconds%SECONDS_PER_DAY)/SECONDS_PER_DAY;
+    
+    if( task->snapshots )
+    {
+        task->snapshots[index] = Ephemeris::solarSystemSnapshotAtJulianDay(context, jd);
+    }
+    else
+    {
+        task->objects[index] = Ephemeris::solarSystemObjectAtJulianDay(context, task->planet, jd);
+    }
+}
+
+// Compute outputs [first,last) of a task
+static void computeRangeIndexes(const EphemerisRangeTask *task, EphemerisContext *context, long first, long last)
+{
+    for(long index=first; index<last; index++)
+    {
+        computeRangeIndex(task, context, index);
+    }
+}
+
+#if EPHEMERIS_USE_THREADS
+
+/*! This structure describes chunks left to one worker (chunk numbers [begin,end)). */
+struct EphemerisRangeWorker
+{
+    std::mutex lock;
+    long       begin;
+    long       end;
+};
+
+// Take first chunk of a worker's own share
+static bool takeRangeChunk(EphemerisRangeWorker *worker, long *chunk)
+{
+    std::lock_guard<std::mutex> guard(worker->lock);
+    
+    if( worker->begin >= worker->end )
+    {
+        return false;
+    }
+    
+    *chunk = worker->begin++;
+    return true;
+}
+
+// Move last half of the largest share left to another worker into an idle worker's share
+static bool stealRangeChunks(EphemerisRangeWorker *workers, int workerCount, int thief)
+{
+    for(;;)
+    {
+        // Busiest worker
+        int  victim    = -1;
+        long remaining = 0;
+        for(int numWorker=0; numWorker<workerCount; numWorker++)
+        {
+            if( numWorker == thief )
+            {
+                continue;
+            }
+            
+            std::lock_guard<std::mutex> guard(workers[numWorker].lock);
+            if( workers[numWorker].end-workers[numWorker].begin > remaining )
+            {
+                remaining = workers[numWorker].end-workers[numWorker].begin;
+                victim    = numWorker;
+            }
+        }
+        
+        if( victim < 0 )
+        {
+            // Every chunk is taken
+            return false;
+        }
+        
+        long begin, end;
+        {
+            std::lock_guard<std::mutex> guard(workers[victim].lock);
+            
+            remaining = workers[victim].end-workers[victim].begin;
+            if( remaining <= 0 )
+            {
+                // Victim finished meanwhile, look again
+                continue;
+            }
+            
+            end   = workers[victim].end;
+            begin = end-(remaining+1)/2;
+            
+            workers[victim].end = begin;
+        }
+        
+        std::lock_guard<std::mutex> guard(workers[thief].lock);
+        workers[thief].begin = begin;
+        workers[thief].end   = end;
+        
+        return true;
+    }
+}
+
+// Compute chunks of a worker, then steal from others until every chunk is taken
+static void runRangeWorker(const EphemerisRangeTask *task, long firstIndex, EphemerisRangeWorker *workers, int workerCount, int self)
+{
+    // Private caches
+    EphemerisContext context = *task->context;
+    
+    do
+    {
+        long chunk;
+        while( takeRangeChunk(&workers[self], &chunk) )
+        {
+            long first = firstIndex + chunk*EPHEMERIS_RANGE_CHUNK;
+            long last  = first + EPHEMERIS_RANGE_CHUNK;
+            
+            computeRangeIndexes(task, &context, first, last < task->count ? last : task->count);
+        }
+    }
+    while( stealRangeChunks(workers, workerCount, self) );
+}
+
+#endif
+
+// Compute every output of a task
+static bool computeRange(const EphemerisRangeTask *task, int threadCount)
+{
+    if( task->context == NULL || task->count < 0 || (task->count > 0 && task->objects == NULL && task->snapshots == NULL) )
+    {
+        return false;
+    }
+    
+    if( task->count == 0 )
+    {
+        return true;
+    }
+    
+    // First date on calling thread: lazily built tables are ready before workers start
+    EphemerisContext context = *task->context;
+    computeRangeIndex(task, &context, 0);
+    
+#if EPHEMERIS_USE_THREADS
+    long chunkCount = (task->count-1+EPHEMERIS_RANGE_CHUNK-1)/EPHEMERIS_RANGE_CHUNK;
+    
+    if( threadCount <= 0 )
+    {
+        threadCount = (int)std::thread::hardware_concurrency();
+    }
+    
+    if( threadCount > chunkCount )
+    {
+        threadCount = (int)chunkCount;
+    }
+    
+    if( threadCount > 1 )
+    {
+        // Even contiguous shares of chunks (calling thread is worker 0)
+        std::vector<EphemerisRangeWorker> workers(threadCount);
+        for(int numWorker=0; numWorker<threadCount; numWorker++)
+        {
+            workers[numWorker].begin = chunkCount*numWorker/threadCount;
+            workers[numWorker].end   = chunkCount*(numWorker+1)/threadCount;
+        }
+        
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount-1);
+        for(int numWorker=1; numWorker<threadCount; numWorker++)
+        {
+            try
+            {
+                threads.push_back(std::thread(runRangeWorker, task, 1L, workers.data(), threadCount, numWorker));
+            }
+            catch(...)
+            {
+                // Shares of threads that could not start are stolen by running workers
+                break;
+            }
+        }
+        
+        runRangeWorker(task, 1, workers.data(), threadCount, 0);
+        
+        for(size_t numThread=0; numThread<threads.size(); numThread++)
+        {
+            threads[numThread].join();
+        }
+        
+        return true;
+    }
+#else
+    (void)threadCount;
+#endif
+    
+    computeRangeIndexes(task, &context, 1, task->count);
+    
+    return true;
+}
+
+bool EphemerisRange::solarSystemObjectsForRange(SolarSystemObjectIndex planet,
+                                                unsigned int day,   unsigned int month,   unsigned int year,
+                                                unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                                unsigned long stepSeconds, long count,
+                                                SolarSystemObject *objects, int threadCount)
+{
+    return solarSystemObjectsForRange(Ephemeris::defaultContext(), planet, day, month, year, hours, minutes, seconds,
+                                      stepSeconds, count, objects, threadCount);
+}
+
+bool EphemerisRange::solarSystemObjectsForRange(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                                unsigned int day,   unsigned int month,   unsigned int year,
+                                                unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                                unsigned long stepSeconds, long count,
+                                                SolarSystemObject *objects, int threadCount)
+{
+    EphemerisRangeTask task = {context, day, month, year, hours, minutes, seconds, stepSeconds, count, planet, objects, NULL};
+    
+    return computeRange(&task, threadCount);
+}
+
+bool EphemerisRange::solarSystemSnapshotsForRange(unsigned int day,   unsigned int month,   unsigned int year,
+                                                  unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                                  unsigned long stepSeconds, long count,
+                                                  SolarSystemSnapshot *snapshots, int threadCount)
+{
+    return solarSystemSnapshotsForRange(Ephemeris::defaultContext(), day, month, year, hours, minutes, seconds,
+                                        stepSeconds, count, snapshots, threadCount);
+}
+
+bool EphemerisRange::solarSystemSnapshotsForRange(const EphemerisContext *context,
+                                                  unsigned int day,   unsigned int month,   unsigned int year,
+                                                  unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                                  unsigned long stepSeconds, long count,
+                                                  SolarSystemSnapshot *snapshots, int threadCount)
+{
+    EphemerisRangeTask task = {context, day, month, year, hours, minutes, seconds, stepSeconds, count, Sun, NULL, snapshots};
+    
+    return computeRange(&task, threadCount);
+}
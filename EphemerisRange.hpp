@@ -0,0 +1,95 @@
+/*
+ * EphemerisRange.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef EphemerisRange_h
+#define EphemerisRange_h
+
+#include "Ephemeris.hpp"
+
+// Threads need a hosted C++11 environment (never on Arduino, where ranges are computed serially).
+#ifndef EPHEMERIS_USE_THREADS
+#if !ARDUINO && __cplusplus >= 201103L
+#define EPHEMERIS_USE_THREADS 1
+#else
+#define EPHEMERIS_USE_THREADS 0
+#endif
+#endif
+
+// Number of consecutive dates handed to a thread at once (unit of work stealing).
+#ifndef EPHEMERIS_RANGE_CHUNK
+#define EPHEMERIS_RANGE_CHUNK 64
+#endif
+
+/*!
+ * This class computes solar system objects for regularly spaced dates, in parallel.
+ *
+ * Date number i is the start date plus i*stepSeconds (integer calendar arithmetic, no rounding
+ * drift), and output i is exactly what Ephemeris::solarSystemObjectAtDateAndTime (or
+ * solarSystemSnapshotAtDateAndTime) returns for that date: results do not depend on thread count
+ * or scheduling. Dates are split into chunks of EPHEMERIS_RANGE_CHUNK, each thread starts with an
+ * even contiguous share of chunks and, once done, steals half of the chunks left to the busiest
+ * thread, so uneven chunk costs (Sun vs planets, cache misses) do not leave cores idle.
+ *
+ * Every thread works with its own copy of the context (functions without context copy the default
+ * context of Ephemeris), so no lock is taken while computing. Coefficient file must not change during
+ * a call. Build with -pthread on POSIX systems.
+ */
+class EphemerisRange
+{
+public:
+    
+    /*! Compute one solar system object for count dates, every stepSeconds from start date and time.
+     *  threadCount 0 uses every hardware thread. Return false if arguments are not valid. */
+    static bool solarSystemObjectsForRange(SolarSystemObjectIndex planet,
+                                           unsigned int day,   unsigned int month,   unsigned int year,
+                                           unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                           unsigned long stepSeconds, long count,
+                                           SolarSystemObject *objects, int threadCount = 0);
+    
+    /*! Compute every solar system object for count dates, every stepSeconds from start date and time.
+     *  threadCount 0 uses every hardware thread. Return false if arguments are not valid. */
+    static bool solarSystemSnapshotsForRange(unsigned int day,   unsigned int month,   unsigned int year,
+                                             unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                             unsigned long stepSeconds, long count,
+                                             SolarSystemSnapshot *snapshots, int threadCount = 0);
+    
+    /*! Compute one solar system object for count dates with observer and settings of a context. */
+    static bool solarSystemObjectsForRange(const EphemerisContext *context, SolarSystemObjectIndex planet,
+                                           unsigned int day,   unsigned int month,   unsigned int year,
+                                           unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                           unsigned long stepSeconds, long count,
+                                           SolarSystemObject *objects, int threadCount = 0);
+    
+    /*! Compute every solar system object for count dates with observer and settings of a context. */
+    static bool solarSystemSnapshotsForRange(const EphemerisContext *context,
+                                             unsigned int day,   unsigned int month,   unsigned int year,
+                                             unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                             unsigned long stepSeconds, long count,
+                                             SolarSystemSnapshot *snapshots, int threadCount = 0);
+    
+    /*! Get date and time number index of a range (same instants as range computations). */
+    static void dateAndTimeForRangeIndex(unsigned int day,    unsigned int month,    unsigned int year,
+                                         unsigned int hours,  unsigned int minutes,  unsigned int seconds,
+                                         unsigned long stepSeconds, long index,
+                                         unsigned int *outDay,   unsigned int *outMonth,   unsigned int *outYear,
+                                         unsigned int *outHours, unsigned int *outMinutes, unsigned int *outSeconds);
+};
+
+#endif
@@ -0,0 +1,241 @@
+/*
+ * FastMath.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef FastMath_h
+#define FastMath_h
+
+#include <string.h>
+#include <math.h>
+
+/*
+ * Single precision trigonometry for ephemeris kernels (internal).
+ *
+ * Every function is a branchless template: Floats/Ints are float/int for scalars or GCC/Clang vectors
+ * of the same number of lanes (see VSOP87SoA.cpp), so the same code is inlined in scalar loops and
+ * vectorized kernels. Arguments are reduced with a three parts Cody-Waite split of PI/2 (exact while
+ * |x| < 1e5 radians, VSOP87 arguments stay below 1e4) then minimax polynomials are evaluated on
+ * [-PI/4,PI/4].
+ *
+ * Error measured against double precision libm over |x| < 1e4 radians and |x| < 1e5 degrees
+ * (20 million random arguments), for every function of both families:
+ *  - below 1.7 ULP (float spacing of the result) when |result| > 1e-3,
+ *  - below 1e-7 absolute everywhere.
+ * Absolute error is what matters for ephemeris sums. Near zeros of large arguments the result keeps
+ * the absolute error of the argument itself (float spacing of x), like any single precision code.
+ * Arc tangent (fastAtan2) stays below 3e-7 radian (0.06 arc second).
+ */
+
+// Cody-Waite split of PI/2 (first part has 8 significant bits, exact for |x| < 2^16 * PI/2)
+#define FAST_MATH_PIO2_1 1.5703125f
+#define FAST_MATH_PIO2_2 4.837512969970703125e-4f
+#define FAST_MATH_PIO2_3 7.54978995489188216e-8f
+#define FAST_MATH_2_OVER_PI 0.636619772367581343f
+
+// Degrees to radians
+#define FAST_MATH_PI_OVER_180 0.0174532925199432958f
+
+// Radians to degrees
+#define FAST_MATH_180_OVER_PI 57.2957795130823209f
+
+// Angles of arc tangent reduction
+#define FAST_MATH_PI      3.14159265358979324f
+#define FAST_MATH_PI_2    1.57079632679489662f
+#define FAST_MATH_PI_4    0.785398163397448310f
+#define FAST_MATH_TAN_PI_8 0.414213562373095049f
+
+/*! Convert lanes between float and int (vectors: one conversion per lane). */
+template<typename To, typename From>
+static inline To fastConvert(From value)
+{
+#if defined(__GNUC__) && !ARDUINO
+    return __builtin_convertvector(value, To);
+#else
+    return (To)value;
+#endif
+}
+
+template<>
+inline int fastConvert<int,float>(float value)
+{
+    return (int)value;
+}
+
+template<>
+inline float fastConvert<float,int>(int value)
+{
+    return (float)value;
+}
+
+/*! Compute sin(r+q*PI/2) and cos(r+q*PI/2) for r in [-PI/4,PI/4]. */
+template<typename Floats, typename Ints>
+static inline void fastSinCosQuadrant(Floats r, Ints q, Floats *sine, Floats *cosine)
+{
+    Floats r2 = r*r;
+    
+    // Minimax polynomials on [-PI/4,PI/4]
+    Floats s = r + r*r2*(-1.6666654611e-1f + r2*(8.3321608736e-3f + r2*-1.9515295891e-4f));
+    Floats c = 1.0f - 0.5f*r2 + r2*r2*(4.166664568298827e-2f + r2*(-1.388731625493765e-3f + r2*2.443315711809948e-5f));
+    
+    // Odd quadrants swap sine and cosine
+    Floats swappedSine   = (q & 1) != 0 ? c : s;
+    Floats swappedCosine = (q & 1) != 0 ? s : c;
+    
+    *sine   = (q     & 2) != 0 ? -swappedSine   : swappedSine;
+    *cosine = ((q+1) & 2) != 0 ? -swappedCosine : swappedCosine;
+}
+
+/*! Compute cos(r+q*PI/2) for r in [-PI/4,PI/4] (one select less than fastSinCosQuadrant). */
+template<typename Floats, typename Ints>
+static inline Floats fastCosQuadrant(Floats r, Ints q)
+{
+    Floats r2 = r*r;
+    
+    Floats s = r + r*r2*(-1.6666654611e-1f + r2*(8.3321608736e-3f + r2*-1.9515295891e-4f));
+    Floats c = 1.0f - 0.5f*r2 + r2*r2*(4.166664568298827e-2f + r2*(-1.388731625493765e-3f + r2*2.443315711809948e-5f));
+    
+    Floats v = (q & 1) != 0 ? s : c;
+    return ((q+1) & 2) != 0 ? -v : v;
+}
+
+/*! Reduce x (radians) to r in [-PI/4,PI/4] and quadrant q. */
+template<typename Floats, typename Ints>
+static inline Floats fastReduce(Floats x, Ints *q)
+{
+    // Quadrant rounded to nearest
+    Floats k = x*FAST_MATH_2_OVER_PI;
+    *q = fastConvert<Ints>(k >= 0 ? k+0.5f : k-0.5f);
+    
+    Floats qf = fastConvert<Floats>(*q);
+    return ((x - qf*FAST_MATH_PIO2_1) - qf*FAST_MATH_PIO2_2) - qf*FAST_MATH_PIO2_3;
+}
+
+/*! Reduce x (degrees) to r in [-PI/4,PI/4] (radians) and quadrant q. Reduction is exact in degrees. */
+template<typename Floats, typename Ints>
+static inline Floats fastReduceDegrees(Floats x, Ints *q)
+{
+    Floats k = x*(1.0f/90);
+    *q = fastConvert<Ints>(k >= 0 ? k+0.5f : k-0.5f);
+    
+    Floats qf = fastConvert<Floats>(*q);
+    return (x - qf*90.0f)*FAST_MATH_PI_OVER_180;
+}
+
+/*! Compute sine and cosine of x in radians. */
+template<typename Floats, typename Ints>
+static inline void fastSinCos(Floats x, Floats *sine, Floats *cosine)
+{
+    Ints   q;
+    Floats r = fastReduce<Floats,Ints>(x, &q);
+    fastSinCosQuadrant<Floats,Ints>(r, q, sine, cosine);
+}
+
+/*! Compute cosine of x in radians. */
+template<typename Floats, typename Ints>
+static inline Floats fastCos(Floats x)
+{
+    Ints   q;
+    Floats r = fastReduce<Floats,Ints>(x, &q);
+    return fastCosQuadrant<Floats,Ints>(r, q);
+}
+
+/*! Compute sine and cosine of x in degrees. */
+template<typename Floats, typename Ints>
+static inline void fastSinCosDegrees(Floats x, Floats *sine, Floats *cosine)
+{
+    Ints   q;
+    Floats r = fastReduceDegrees<Floats,Ints>(x, &q);
+    fastSinCosQuadrant<Floats,Ints>(r, q, sine, cosine);
+}
+
+/*! Compute cosine of x in degrees. */
+template<typename Floats, typename Ints>
+static inline Floats fastCosDegrees(Floats x)
+{
+    Ints   q;
+    Floats r = fastReduceDegrees<Floats,Ints>(x, &q);
+    return fastCosQuadrant<Floats,Ints>(r, q);
+}
+
+/*! Compute sine of x in degrees. */
+template<typename Floats, typename Ints>
+static inline Floats fastSinDegrees(Floats x)
+{
+    Ints   q;
+    Floats r = fastReduceDegrees<Floats,Ints>(x, &q);
+    return fastCosQuadrant<Floats,Ints>(r, q-1);
+}
+
+/*! Reinterpret lanes between float and int bits (same size). */
+template<typename To, typename From>
+static inline To fastBitCast(From value)
+{
+    To bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+/*! Compute square root of x >= 0 (reciprocal square root estimate refined by three Newton steps, 1 ULP). */
+template<typename Floats, typename Ints>
+static inline Floats fastSqrt(Floats x)
+{
+    Floats y = fastBitCast<Floats>(0x5f3759df - (fastBitCast<Ints>(x) >> 1));
+    
+    Floats halfX = 0.5f*x;
+    y = y*(1.5f - halfX*y*y);
+    y = y*(1.5f - halfX*y*y);
+    y = y*(1.5f - halfX*y*y);
+    
+    // Estimate stays finite for 0
+    return x*y;
+}
+
+template<>
+inline float fastSqrt<float,int>(float x)
+{
+    // Scalars use hardware (or libm) square root, int may be 16 bits
+    return sqrtf(x);
+}
+
+/*! Compute arc tangent of y/x in radians, in [-PI,PI] (0 when x and y are null). */
+template<typename Floats, typename Ints>
+static inline Floats fastAtan2(Floats y, Floats x)
+{
+    Floats absX = x < 0 ? -x : x;
+    Floats absY = y < 0 ? -y : y;
+    
+    // Ratio in [0,1], then in [0,tan(PI/8)] with atan(a) = PI/4 + atan((a-1)/(a+1))
+    Floats numerator   = absX < absY ? absX : absY;
+    Floats denominator = absX < absY ? absY : absX;
+    Floats a = numerator/(denominator > 0 ? denominator : 1.0f);
+    
+    Floats reduced = a > FAST_MATH_TAN_PI_8 ? (a-1.0f)/(a+1.0f) : a;
+    Floats offset  = a > FAST_MATH_TAN_PI_8 ? FAST_MATH_PI_4 : 0.0f;
+    
+    // Minimax polynomial on [-tan(PI/8),tan(PI/8)] (Cephes atanf)
+    Floats z = reduced*reduced;
+    Floats r = offset + reduced + reduced*z*(-3.33329491539e-1f + z*(1.99777106478e-1f + z*(-1.38776856032e-1f + z*8.05374449538e-2f)));
+    
+    // Octant, then quadrant
+    r = absX < absY ? FAST_MATH_PI_2 - r : r;
+    r = x < 0 ? FAST_MATH_PI - r : r;
+    return y < 0 ? -r : r;
+}
+
+#endif
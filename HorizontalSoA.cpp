@@ -0,0 +1,124 @@
+/*
+ * HorizontalSoA.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "HorizontalSoA.hpp"
+#include "FastMath.hpp"
+
+#if defined(__GNUC__) && !ARDUINO
+// One register of sites (GCC/Clang vector extensions, see VSOP87SoA.cpp)
+typedef float SitesFloats __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(float))));
+typedef int   SitesInts   __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(int))));
+
+static inline SitesFloats sitesLoad(const float *values)
+{
+    SitesFloats vector;
+    memcpy(&vector, values, sizeof(vector));
+    return vector;
+}
+
+static inline void sitesStore(float *values, SitesFloats vector)
+{
+    memcpy(values, &vector, sizeof(vector));
+}
+#endif
+
+// Horizontal coordinates of sites from hour angle at Greenwich in degrees (scalars or vectors of sites)
+template<typename Floats, typename Ints>
+static inline void horizontalForSites(float greenwichH, float sinDelta, float cosDelta,
+                                      Floats longitude, Floats sinPhi, Floats cosPhi,
+                                      Floats *altitude, Floats *azimuth)
+{
+    // Local hour angle
+    Floats sinH, cosH;
+    fastSinCosDegrees<Floats,Ints>(greenwichH - longitude, &sinH, &cosH);
+    
+    // Horizontal direction (Meeus 13.5 and 13.6, multiplied by cos(delta) >= 0: no division)
+    Floats x = cosH*cosDelta*sinPhi - sinDelta*cosPhi;
+    Floats y = sinH*cosDelta;
+    Floats z = sinPhi*sinDelta + cosPhi*cosDelta*cosH;
+    
+    // Altitude from both components (asin of z alone loses precision near zenith)
+    *altitude = fastAtan2<Floats,Ints>(z, fastSqrt<Floats,Ints>(x*x + y*y))*FAST_MATH_180_OVER_PI;
+    
+    Floats A = fastAtan2<Floats,Ints>(y, x)*FAST_MATH_180_OVER_PI + 180.0f;
+    *azimuth = A >= 360.0f ? A-360.0f : A;
+}
+
+void HorizontalSoA::prepareSites(const float *latitudes, const float *longitudes, int count,
+                                 float *sinLatitudes, float *cosLatitudes, ObserverSitesSoA *sites)
+{
+    int site = 0;
+    
+#if defined(__GNUC__) && !ARDUINO
+    for(; site+VSOP87_SOA_LANES<=count; site+=VSOP87_SOA_LANES)
+    {
+        SitesFloats sine, cosine;
+        fastSinCosDegrees<SitesFloats,SitesInts>(sitesLoad(latitudes+site), &sine, &cosine);
+        
+        sitesStore(sinLatitudes+site, sine);
+        sitesStore(cosLatitudes+site, cosine);
+    }
+#endif
+    
+    for(; site<count; site++)
+    {
+        fastSinCosDegrees<float,int>(latitudes[site], &sinLatitudes[site], &cosLatitudes[site]);
+    }
+    
+    sites->count       = count;
+    sites->longitude   = longitudes;
+    sites->sinLatitude = sinLatitudes;
+    sites->cosLatitude = cosLatitudes;
+}
+
+void HorizontalSoA::horizontalCoordinatesForSites(EquatorialCoordinates coordinates, float apparentSiderealTime,
+                                                  const ObserverSitesSoA *sites, float *altitudes, float *azimuths)
+{
+    // Hour angle at Greenwich in degrees and declination, shared by every site
+    float greenwichH = (apparentSiderealTime-coordinates.ra)*15;
+    
+    float sinDelta, cosDelta;
+    fastSinCosDegrees<float,int>(coordinates.dec, &sinDelta, &cosDelta);
+    
+    int site = 0;
+    
+#if defined(__GNUC__) && !ARDUINO
+    for(; site+VSOP87_SOA_LANES<=sites->count; site+=VSOP87_SOA_LANES)
+    {
+        SitesFloats altitude, azimuth;
+        horizontalForSites<SitesFloats,SitesInts>(greenwichH, sinDelta, cosDelta,
+                                                  sitesLoad(sites->longitude+site),
+                                                  sitesLoad(sites->sinLatitude+site),
+                                                  sitesLoad(sites->cosLatitude+site),
+                                                  &altitude, &azimuth);
+        
+        sitesStore(altitudes+site, altitude);
+        sitesStore(azimuths+site,  azimuth);
+    }
+#endif
+    
+    // Remaining sites
+    for(; site<sites->count; site++)
+    {
+        horizontalForSites<float,int>(greenwichH, sinDelta, cosDelta,
+                                      sites->longitude[site], sites->sinLatitude[site], sites->cosLatitude[site],
+                                      &altitudes[site], &azimuths[site]);
+    }
+}
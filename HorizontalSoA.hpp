@@ -0,0 +1,62 @@
+/*
+ * HorizontalSoA.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef HorizontalSoA_h
+#define HorizontalSoA_h
+
+#include "Ephemeris.hpp"
+#include "VSOP87SoA.hpp"
+
+/*! This structure describes observer sites stored as structure of arrays (see HorizontalSoA::prepareSites).
+ *  Arrays belong to the caller. */
+struct ObserverSitesSoA
+{
+    /*! Number of sites. */
+    int count;
+    
+    /*! Longitudes in floating degrees (same convention as Ephemeris::setLocationOnEarth). */
+    const float *longitude;
+    
+    /*! Sine and cosine of latitudes, computed once. */
+    float *sinLatitude;
+    float *cosLatitude;
+};
+
+/*!
+ * This class converts one equatorial position to horizontal coordinates for many observer sites,
+ * VSOP87_SOA_LANES sites at a time with FastMath.hpp trigonometry (0.2 arc second, see
+ * Ephemeris::equatorialToHorizontal for the scalar reference).
+ */
+class HorizontalSoA
+{
+public:
+    
+    /*! Set sites from latitudes and longitudes in floating degrees, with arrays of count floats
+     *  receiving sine and cosine of latitudes. */
+    static void prepareSites(const float *latitudes, const float *longitudes, int count,
+                             float *sinLatitudes, float *cosLatitudes, ObserverSitesSoA *sites);
+    
+    /*! Compute altitude and azimuth in floating degrees of an object for every site (arrays of sites->count floats),
+     *  from apparent sidereal time at Greenwich in floating hours (see Ephemeris::apparentSiderealTimeForJulianDay). */
+    static void horizontalCoordinatesForSites(EquatorialCoordinates coordinates, float apparentSiderealTime,
+                                              const ObserverSitesSoA *sites, float *altitudes, float *azimuths);
+};
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ * IAU1980Nutation.h
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IAU1980Nutation_h
+#define IAU1980Nutation_h
+
+#ifndef CONST
+#if ARDUINO
+#define CONST const PROGMEM
+#else
+#define CONST const
+#endif
+#endif
+
+// Fundamental arguments of nutation (D, M, M', F, omega) and largest multiple used by the series
+#define NUTATION_ARGUMENT_COUNT 5
+#define NUTATION_MAX_MULTIPLE   4
+
+/*! This structure describes one term of the IAU 1980 theory of nutation.
+ *  Argument is D*D + M*M + Mm*M' + F*F + omega*omega (Meeus chapter 22). */
+struct NutationTerm
+{
+    /*! Multiples of mean elongation of the Moon, mean anomaly of the Sun, mean anomaly of the Moon,
+     *  argument of latitude of the Moon and longitude of the ascending node of the Moon. */
+    signed char D;
+    signed char M;
+    signed char Mm;
+    signed char F;
+    signed char omega;
+    
+    /*! Nutation in longitude (sine coefficient) and its rate per Julian century, in 0.0001 arc second. */
+    float longitude;
+    float longitudeRate;
+    
+    /*! Nutation in obliquity (cosine coefficient) and its rate per Julian century, in 0.0001 arc second. */
+    float obliquity;
+    float obliquityRate;
+};
+
+////////////////////////////////////////////////////////////
+//
+//         The 106 terms of the IAU 1980 theory of nutation (Seidelmann 1982).
+//
+
+CONST NutationTerm IAU1980NutationTerms[] =
+{
+    { 0,  0,  0,  0,  1, -171996.0, -174.2,  92025.0,   8.9},
+    { 0,  0,  0,  0,  2,    2062.0,    0.2,   -895.0,   0.5},
+    { 0,  0, -2,  2,  1,      46.0,    0.0,    -24.0,   0.0},
+    { 0,  0,  2, -2,  0,      11.0,    0.0,      0.0,   0.0},
+    { 0,  0, -2,  2,  2,      -3.0,    0.0,      1.0,   0.0},
+    {-1, -1,  1,  0,  0,      -3.0,    0.0,      0.0,   0.0},
+    {-2, -2,  0,  2,  1,      -2.0,    0.0,      1.0,   0.0},
+    { 0,  0,  2, -2,  1,       1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  0,  2,  2,  -13187.0,   -1.6,   5736.0,  -3.1},
+    { 0,  1,  0,  0,  0,    1426.0,   -3.4,     54.0,  -0.1},
+    {-2,  1,  0,  2,  2,    -517.0,    1.2,    224.0,  -0.6},
+    {-2, -1,  0,  2,  2,     217.0,   -0.5,    -95.0,   0.3},
+    {-2,  0,  0,  2,  1,     129.0,    0.1,    -70.0,   0.0},
+    {-2,  0,  2,  0,  0,      48.0,    0.0,      1.0,   0.0},
+    {-2,  0,  0,  2,  0,     -22.0,    0.0,      0.0,   0.0},
+    { 0,  2,  0,  0,  0,      17.0,   -0.1,      0.0,   0.0},
+    { 0,  1,  0,  0,  1,     -15.0,    0.0,      9.0,   0.0},
+    {-2,  2,  0,  2,  2,     -16.0,    0.1,      7.0,   0.0},
+    { 0, -1,  0,  0,  1,     -12.0,    0.0,      6.0,   0.0},
+    { 2,  0, -2,  0,  1,      -6.0,    0.0,      3.0,   0.0},
+    {-2, -1,  0,  2,  1,      -5.0,    0.0,      3.0,   0.0},
+    {-2,  0,  2,  0,  1,       4.0,    0.0,     -2.0,   0.0},
+    {-2,  1,  0,  2,  1,       4.0,    0.0,     -2.0,   0.0},
+    {-1,  0,  1,  0,  0,      -4.0,    0.0,      0.0,   0.0},
+    {-2,  1,  2,  0,  0,       1.0,    0.0,      0.0,   0.0},
+    { 2,  0,  0, -2,  1,       1.0,    0.0,      0.0,   0.0},
+    { 2,  1,  0, -2,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 0,  1,  0,  0,  2,       1.0,    0.0,      0.0,   0.0},
+    { 1,  0, -1,  0,  1,       1.0,    0.0,      0.0,   0.0},
+    {-2,  1,  0,  2,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 0,  0,  0,  2,  2,   -2274.0,   -0.2,    977.0,  -0.5},
+    { 0,  0,  1,  0,  0,     712.0,    0.1,     -7.0,   0.0},
+    { 0,  0,  0,  2,  1,    -386.0,   -0.4,    200.0,   0.0},
+    { 0,  0,  1,  2,  2,    -301.0,    0.0,    129.0,  -0.1},
+    {-2,  0,  1,  0,  0,    -158.0,    0.0,     -1.0,   0.0},
+    { 0,  0, -1,  2,  2,     123.0,    0.0,    -53.0,   0.0},
+    { 2,  0,  0,  0,  0,      63.0,    0.0,     -2.0,   0.0},
+    { 0,  0,  1,  0,  1,      63.0,    0.1,    -33.0,   0.0},
+    { 0,  0, -1,  0,  1,     -58.0,   -0.1,     32.0,   0.0},
+    { 2,  0, -1,  2,  2,     -59.0,    0.0,     26.0,   0.0},
+    { 0,  0,  1,  2,  1,     -51.0,    0.0,     27.0,   0.0},
+    { 2,  0,  0,  2,  2,     -38.0,    0.0,     16.0,   0.0},
+    { 0,  0,  2,  0,  0,      29.0,    0.0,     -1.0,   0.0},
+    {-2,  0,  1,  2,  2,      29.0,    0.0,    -12.0,   0.0},
+    { 0,  0,  2,  2,  2,     -31.0,    0.0,     13.0,   0.0},
+    { 0,  0,  0,  2,  0,      26.0,    0.0,     -1.0,   0.0},
+    { 0,  0, -1,  2,  1,      21.0,    0.0,    -10.0,   0.0},
+    { 2,  0, -1,  0,  1,      16.0,    0.0,     -8.0,   0.0},
+    {-2,  0,  1,  0,  1,     -13.0,    0.0,      7.0,   0.0},
+    { 2,  0, -1,  2,  1,     -10.0,    0.0,      5.0,   0.0},
+    {-2,  1,  1,  0,  0,      -7.0,    0.0,      0.0,   0.0},
+    { 0,  1,  0,  2,  2,       7.0,    0.0,     -3.0,   0.0},
+    { 0, -1,  0,  2,  2,      -7.0,    0.0,      3.0,   0.0},
+    { 2,  0,  1,  2,  2,      -8.0,    0.0,      3.0,   0.0},
+    { 2,  0,  1,  0,  0,       6.0,    0.0,      0.0,   0.0},
+    {-2,  0,  2,  2,  2,       6.0,    0.0,     -3.0,   0.0},
+    { 2,  0,  0,  0,  1,      -6.0,    0.0,      3.0,   0.0},
+    { 2,  0,  0,  2,  1,      -7.0,    0.0,      3.0,   0.0},
+    {-2,  0,  1,  2,  1,       6.0,    0.0,     -3.0,   0.0},
+    {-2,  0,  0,  0,  1,      -5.0,    0.0,      3.0,   0.0},
+    { 0, -1,  1,  0,  0,       5.0,    0.0,      0.0,   0.0},
+    { 0,  0,  2,  2,  1,      -5.0,    0.0,      3.0,   0.0},
+    {-2,  1,  0,  0,  0,      -4.0,    0.0,      0.0,   0.0},
+    { 0,  0,  1, -2,  0,       4.0,    0.0,      0.0,   0.0},
+    { 1,  0,  0,  0,  0,      -4.0,    0.0,      0.0,   0.0},
+    { 0,  1,  1,  0,  0,      -3.0,    0.0,      0.0,   0.0},
+    { 0,  0,  1,  2,  0,       3.0,    0.0,      0.0,   0.0},
+    { 0, -1,  1,  2,  2,      -3.0,    0.0,      1.0,   0.0},
+    { 2, -1, -1,  2,  2,      -3.0,    0.0,      1.0,   0.0},
+    { 0,  0, -2,  0,  1,      -2.0,    0.0,      1.0,   0.0},
+    { 0,  0,  3,  2,  2,      -3.0,    0.0,      1.0,   0.0},
+    { 2, -1,  0,  2,  2,      -3.0,    0.0,      1.0,   0.0},
+    { 0,  1,  1,  2,  2,       2.0,    0.0,     -1.0,   0.0},
+    {-2,  0, -1,  2,  1,      -2.0,    0.0,      1.0,   0.0},
+    { 0,  0,  2,  0,  1,       2.0,    0.0,     -1.0,   0.0},
+    { 0,  0,  1,  0,  2,      -2.0,    0.0,      1.0,   0.0},
+    { 0,  0,  3,  0,  0,       2.0,    0.0,      0.0,   0.0},
+    { 1,  0,  0,  2,  2,       2.0,    0.0,     -1.0,   0.0},
+    { 0,  0, -1,  0,  2,       1.0,    0.0,     -1.0,   0.0},
+    {-4,  0,  1,  0,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 2,  0, -2,  2,  2,       1.0,    0.0,     -1.0,   0.0},
+    { 4,  0, -1,  2,  2,      -2.0,    0.0,      1.0,   0.0},
+    {-4,  0,  2,  0,  0,      -1.0,    0.0,      0.0,   0.0},
+    {-2,  1,  1,  2,  2,       1.0,    0.0,     -1.0,   0.0},
+    { 2,  0,  1,  2,  1,      -1.0,    0.0,      1.0,   0.0},
+    { 4,  0, -2,  2,  2,      -1.0,    0.0,      1.0,   0.0},
+    { 0,  0, -1,  4,  2,       1.0,    0.0,      0.0,   0.0},
+    {-2, -1,  1,  0,  0,       1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  2,  2,  1,       1.0,    0.0,     -1.0,   0.0},
+    { 2,  0,  2,  2,  2,      -1.0,    0.0,      0.0,   0.0},
+    { 2,  0,  1,  0,  1,      -1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  0,  4,  2,       1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  3,  2,  2,       1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  1,  2,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 0,  1,  0,  2,  1,       1.0,    0.0,      0.0,   0.0},
+    { 2, -1, -1,  0,  1,       1.0,    0.0,      0.0,   0.0},
+    { 0,  0,  0, -2,  1,      -1.0,    0.0,      0.0,   0.0},
+    {-1,  0,  0,  2,  2,      -1.0,    0.0,      0.0,   0.0},
+    { 2,  1,  0,  0,  0,      -1.0,    0.0,      0.0,   0.0},
+    {-2,  0,  1, -2,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 0, -1,  0,  2,  1,      -1.0,    0.0,      0.0,   0.0},
+    {-2,  1,  1,  0,  1,      -1.0,    0.0,      0.0,   0.0},
+    { 2,  0,  1, -2,  0,      -1.0,    0.0,      0.0,   0.0},
+    { 2,  0,  2,  0,  0,       1.0,    0.0,      0.0,   0.0},
+    { 4,  0,  0,  2,  2,      -1.0,    0.0,      0.0,   0.0},
+    { 1,  1,  0,  0,  0,       1.0,    0.0,      0.0,   0.0}
+};
+
+#endif
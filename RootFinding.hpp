@@ -0,0 +1,185 @@
+/*
+ * RootFinding.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef RootFinding_h
+#define RootFinding_h
+
+#include <math.h>
+
+/*
+ * Bracketed root finding for event searches (internal).
+ *
+ * Function is any object with float operator()(float x). Roots are searched in a bracket [a,b]
+ * where function values have opposite signs, so the result always stays inside the bracket.
+ */
+
+/*! Find a root of function in [a,b] with Brent's method (inverse quadratic interpolation, secant and
+ *  bisection steps), function values fa and fb at a and b being of opposite signs. Return root
+ *  within tolerance, after at most maxEvaluations new function evaluations. */
+template<typename Function>
+static float brentRoot(Function *function, float a, float b, float fa, float fb, float tolerance, int maxEvaluations)
+{
+    float c  = b;
+    float fc = fb;
+    float d  = b-a;
+    float e  = d;
+    
+    for(int evaluation=0; evaluation<=maxEvaluations; evaluation++)
+    {
+        // Keep root between b and c, b being the best estimate
+        if( (fb > 0 && fc > 0) || (fb < 0 && fc < 0) )
+        {
+            c  = a;
+            fc = fa;
+            d  = b-a;
+            e  = d;
+        }
+        
+        if( fabs(fc) < fabs(fb) )
+        {
+            a  = b;
+            b  = c;
+            c  = a;
+            fa = fb;
+            fb = fc;
+            fc = fa;
+        }
+        
+        float halfTolerance = 0.5f*tolerance;
+        float middle        = 0.5f*(c-b);
+        if( fabs(middle) <= halfTolerance || fb == 0 || evaluation == maxEvaluations )
+        {
+            return b;
+        }
+        
+        if( fabs(e) >= halfTolerance && fabs(fa) > fabs(fb) )
+        {
+            // Secant (two points) or inverse quadratic interpolation (three points)
+            float p, q;
+            float s = fb/fa;
+            if( a == c )
+            {
+                p = 2*middle*s;
+                q = 1-s;
+            }
+            else
+            {
+                float r = fb/fc;
+                q = fa/fc;
+                p = s*(2*middle*q*(q-r) - (b-a)*(r-1));
+                q = (q-1)*(r-1)*(s-1);
+            }
+            
+            if( p > 0 )
+            {
+                q = -q;
+            }
+            else
+            {
+                p = -p;
+            }
+            
+            // Accept interpolation only if it falls inside the bracket and converges fast enough
+            float bound1 = 3*middle*q - fabs(halfTolerance*q);
+            float bound2 = fabs(e*q);
+            if( 2*p < (bound1 < bound2 ? bound1 : bound2) )
+            {
+                e = d;
+                d = p/q;
+            }
+            else
+            {
+                d = middle;
+                e = d;
+            }
+        }
+        else
+        {
+            // Bisection
+            d = middle;
+            e = d;
+        }
+        
+        a  = b;
+        fa = fb;
+        b += fabs(d) > halfTolerance ? d : (middle > 0 ? halfTolerance : -halfTolerance);
+        fb = (*function)(b);
+    }
+    
+    return b;
+}
+
+/*! Find n in [nMin,nMax] where quadratic through (-1,y0), (0,y1) and (1,y2) is null (Meeus chapter 3
+ *  interpolation, n in units of sample spacing from central sample). Return NAN if none. */
+static inline float quadraticRoot(float y0, float y1, float y2, float nMin, float nMax)
+{
+    // y(n) = y1 + n/2*(a+b+n*c)
+    float a = y1-y0;
+    float b = y2-y1;
+    float c = b-a;
+    
+    float n0 = NAN;
+    if( fabs(c) <= 1e-6f*(fabs(a)+fabs(b)) )
+    {
+        // Straight line
+        if( a+b != 0 )
+        {
+            n0 = -2*y1/(a+b);
+        }
+    }
+    else
+    {
+        float discriminant = (a+b)*(a+b) - 8*c*y1;
+        if( discriminant >= 0 )
+        {
+            float root  = sqrtf(discriminant);
+            float nLow  = (-(a+b)-root)/(2*c);
+            float nHigh = (-(a+b)+root)/(2*c);
+            n0 = (nLow >= nMin && nLow <= nMax) ? nLow : nHigh;
+        }
+    }
+    
+    if( isnan(n0) || n0 < nMin || n0 > nMax )
+    {
+        return NAN;
+    }
+    
+    return n0;
+}
+
+/*! Find extremum of quadratic through (-1,y0), (0,y1) and (1,y2) (see quadraticRoot).
+ *  Return n of extremum and its value in extremum, NAN for a straight line. */
+static inline float quadraticExtremum(float y0, float y1, float y2, float *extremum)
+{
+    float a = y1-y0;
+    float b = y2-y1;
+    float c = b-a;
+    
+    if( c == 0 )
+    {
+        *extremum = NAN;
+        return NAN;
+    }
+    
+    *extremum = y1 - (a+b)*(a+b)/(8*c);
+    return -(a+b)/(2*c);
+}
+
+#endif
@@ -0,0 +1,269 @@
+/*
+ * StarCatalogSoA.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "StarCatalogSoA.hpp"
+#include "FastMath.hpp"
+
+// Constant of aberration in radians (20.49552 arc seconds)
+#define ABERRATION_CONSTANT (20.49552/3600*FAST_MATH_PI_OVER_180)
+
+#if defined(__GNUC__) && !ARDUINO
+// One register of stars (GCC/Clang vector extensions, see VSOP87SoA.cpp)
+typedef float StarsFloats __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(float))));
+typedef int   StarsInts   __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(int))));
+
+static inline StarsFloats starsLoad(const float *values)
+{
+    StarsFloats vector;
+    memcpy(&vector, values, sizeof(vector));
+    return vector;
+}
+
+static inline void starsStore(float *values, StarsFloats vector)
+{
+    memcpy(values, &vector, sizeof(vector));
+}
+#endif
+
+// Sine and cosine of an angle in floating degrees (frame setup, libm accuracy)
+static void sinCosDegrees(float angle, float *sine, float *cosine)
+{
+    *sine   = sin(angle*FAST_MATH_PI_OVER_180);
+    *cosine = cos(angle*FAST_MATH_PI_OVER_180);
+}
+
+// Product of a 3x3 rotation by a 3x3 rotation or a 3x4 transform (columns of right operand)
+static void multiplyTransforms(const float left[3][3], const float right[3][4], int columns, float result[3][4])
+{
+    for(int row=0; row<3; row++)
+    {
+        for(int column=0; column<columns; column++)
+        {
+            result[row][column] = left[row][0]*right[0][column] + left[row][1]*right[1][column] + left[row][2]*right[2][column];
+        }
+    }
+}
+
+// Transformed direction of stars (scalars or vectors of stars)
+template<typename Floats>
+static inline void transformStars(const float transform[3][4], Floats x, Floats y, Floats z,
+                                  Floats *u, Floats *v, Floats *w)
+{
+    *u = transform[0][0]*x + transform[0][1]*y + transform[0][2]*z + transform[0][3];
+    *v = transform[1][0]*x + transform[1][1]*y + transform[1][2]*z + transform[1][3];
+    *w = transform[2][0]*x + transform[2][1]*y + transform[2][2]*z + transform[2][3];
+}
+
+// Longitude in ]-180,180] and latitude in floating degrees of a direction (length does not matter)
+template<typename Floats, typename Ints>
+static inline void anglesForDirection(Floats u, Floats v, Floats w, Floats *longitude, Floats *latitude)
+{
+    *longitude = fastAtan2<Floats,Ints>(v, u)*FAST_MATH_180_OVER_PI;
+    *latitude  = fastAtan2<Floats,Ints>(w, fastSqrt<Floats,Ints>(u*u + v*v))*FAST_MATH_180_OVER_PI;
+}
+
+template<typename Floats, typename Ints>
+static inline void apparentForStars(const StarCatalogFrame *frame, Floats x, Floats y, Floats z,
+                                    Floats *rightAscension, Floats *declination)
+{
+    Floats u, v, w, alpha;
+    transformStars<Floats>(frame->equatorial, x, y, z, &u, &v, &w);
+    anglesForDirection<Floats,Ints>(u, v, w, &alpha, declination);
+    
+    alpha /= 15.0f;
+    *rightAscension = alpha < 0.0f ? alpha+24.0f : alpha;
+}
+
+template<typename Floats, typename Ints>
+static inline void horizontalForStars(const StarCatalogFrame *frame, Floats x, Floats y, Floats z,
+                                      Floats *altitude, Floats *azimuth)
+{
+    // Same axes as Ephemeris::equatorialToHorizontal: azimuth measured from south, then from north
+    Floats u, v, w, A;
+    transformStars<Floats>(frame->horizontal, x, y, z, &u, &v, &w);
+    anglesForDirection<Floats,Ints>(u, v, w, &A, altitude);
+    
+    A += 180.0f;
+    *azimuth = A >= 360.0f ? A-360.0f : A;
+}
+
+void StarCatalogSoA::prepareStars(const float *rightAscensions, const float *declinations, int count,
+                                  float *x, float *y, float *z, StarsSoA *stars)
+{
+    int star = 0;
+    
+#if defined(__GNUC__) && !ARDUINO
+    for(; star+VSOP87_SOA_LANES<=count; star+=VSOP87_SOA_LANES)
+    {
+        StarsFloats sinAlpha, cosAlpha, sinDelta, cosDelta;
+        fastSinCosDegrees<StarsFloats,StarsInts>(starsLoad(rightAscensions+star)*15.0f, &sinAlpha, &cosAlpha);
+        fastSinCosDegrees<StarsFloats,StarsInts>(starsLoad(declinations+star),          &sinDelta, &cosDelta);
+        
+        starsStore(x+star, cosDelta*cosAlpha);
+        starsStore(y+star, cosDelta*sinAlpha);
+        starsStore(z+star, sinDelta);
+    }
+#endif
+    
+    for(; star<count; star++)
+    {
+        float sinAlpha, cosAlpha, sinDelta, cosDelta;
+        fastSinCosDegrees<float,int>(rightAscensions[star]*15, &sinAlpha, &cosAlpha);
+        fastSinCosDegrees<float,int>(declinations[star],       &sinDelta, &cosDelta);
+        
+        x[star] = cosDelta*cosAlpha;
+        y[star] = cosDelta*sinAlpha;
+        z[star] = sinDelta;
+    }
+    
+    stars->count = count;
+    stars->x     = x;
+    stars->y     = y;
+    stars->z     = z;
+}
+
+void StarCatalogSoA::frameAtDateAndTime(EphemerisContext *context,
+                                        unsigned int day,   unsigned int month,   unsigned int year,
+                                        unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                        StarCatalogFrame *frame)
+{
+    // Stars do not need Earth position
+    EphemerisEpoch epoch;
+    Ephemeris::epochForDateAndTime(context, day, month, year, hours, minutes, seconds, false, &epoch);
+    
+    float T = epoch.T;
+    
+    // Precession from J2000 (chapter 21, IAU 1976 angles in arc seconds)
+    float zeta  = T*(2306.2181 + T*(0.30188 + T*0.017998));
+    float z     = T*(2306.2181 + T*(1.09468 + T*0.018203));
+    float theta = T*(2004.3109 - T*(0.42665 + T*0.041833));
+    
+    float sinZeta, cosZeta, sinZ, cosZ, sinTheta, cosTheta;
+    sinCosDegrees(zeta/3600,  &sinZeta,  &cosZeta);
+    sinCosDegrees(z/3600,     &sinZ,     &cosZ);
+    sinCosDegrees(theta/3600, &sinTheta, &cosTheta);
+    
+    float precession[3][4] =
+    {
+        { cosZeta*cosTheta*cosZ-sinZeta*sinZ, -sinZeta*cosTheta*cosZ-cosZeta*sinZ, -sinTheta*cosZ, 0},
+        { cosZeta*cosTheta*sinZ+sinZeta*cosZ, -sinZeta*cosTheta*sinZ+cosZeta*cosZ, -sinTheta*sinZ, 0},
+        { cosZeta*sinTheta,                   -sinZeta*sinTheta,                    cosTheta,      0}
+    };
+    
+    // Nutation: from mean equator of date (mean obliquity) to true equator of date (true obliquity)
+    float sinPsi, cosPsi, sinEps0, cosEps0, sinEps, cosEps;
+    sinCosDegrees(epoch.deltaNutation/3600,                  &sinPsi,  &cosPsi);
+    sinCosDegrees(epoch.obliquity-epoch.deltaObliquity/3600, &sinEps0, &cosEps0);
+    sinCosDegrees(epoch.obliquity,                           &sinEps,  &cosEps);
+    
+    float nutation[3][3] =
+    {
+        { cosPsi,        -sinPsi*cosEps0,                      -sinPsi*sinEps0                      },
+        { sinPsi*cosEps,  cosPsi*cosEps*cosEps0+sinEps*sinEps0,  cosPsi*cosEps*sinEps0-sinEps*cosEps0 },
+        { sinPsi*sinEps,  cosPsi*sinEps*cosEps0-cosEps*sinEps0,  cosPsi*sinEps*sinEps0+cosEps*cosEps0 }
+    };
+    
+    multiplyTransforms(nutation, precession, 3, frame->equatorial);
+    
+    // Annual aberration: Earth velocity over light speed, ecliptic then equator of date (chapter 23)
+    float sinSun, cosSun, sinPi, cosPi;
+    sinCosDegrees(epoch.sunLongitude,    &sinSun, &cosSun);
+    sinCosDegrees(epoch.earthPerihelion, &sinPi,  &cosPi);
+    
+    float velocityX =  ABERRATION_CONSTANT*(sinSun - epoch.earthEccentricity*sinPi);
+    float velocityY = -ABERRATION_CONSTANT*(cosSun - epoch.earthEccentricity*cosPi);
+    
+    frame->equatorial[0][3] = velocityX;
+    frame->equatorial[1][3] = velocityY*cosEps;
+    frame->equatorial[2][3] = velocityY*sinEps;
+    
+    // Local apparent sidereal time and latitude (same longitude convention as Ephemeris)
+    float sinTheta0, cosTheta0, sinPhi, cosPhi;
+    sinCosDegrees(epoch.apparentSiderealTime*15 - context->longitude, &sinTheta0, &cosTheta0);
+    sinCosDegrees(context->latitude,                                  &sinPhi,    &cosPhi);
+    
+    float horizontal[3][3] =
+    {
+        { sinPhi*cosTheta0, sinPhi*sinTheta0, -cosPhi },
+        { sinTheta0,        -cosTheta0,        0      },
+        { cosPhi*cosTheta0, cosPhi*sinTheta0,  sinPhi }
+    };
+    
+    multiplyTransforms(horizontal, frame->equatorial, 4, frame->horizontal);
+}
+
+void StarCatalogSoA::frameAtDateAndTime(unsigned int day,   unsigned int month,   unsigned int year,
+                                        unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                        StarCatalogFrame *frame)
+{
+    frameAtDateAndTime(Ephemeris::defaultContext(), day, month, year, hours, minutes, seconds, frame);
+}
+
+void StarCatalogSoA::apparentCoordinatesForStars(const StarCatalogFrame *frame, const StarsSoA *stars,
+                                                 float *rightAscensions, float *declinations)
+{
+    int star = 0;
+    
+#if defined(__GNUC__) && !ARDUINO
+    for(; star+VSOP87_SOA_LANES<=stars->count; star+=VSOP87_SOA_LANES)
+    {
+        StarsFloats alpha, delta;
+        apparentForStars<StarsFloats,StarsInts>(frame,
+                                                starsLoad(stars->x+star), starsLoad(stars->y+star), starsLoad(stars->z+star),
+                                                &alpha, &delta);
+        
+        starsStore(rightAscensions+star, alpha);
+        starsStore(declinations+star,    delta);
+    }
+#endif
+    
+    // Remaining stars
+    for(; star<stars->count; star++)
+    {
+        apparentForStars<float,int>(frame, stars->x[star], stars->y[star], stars->z[star],
+                                    &rightAscensions[star], &declinations[star]);
+    }
+}
+
+void StarCatalogSoA::horizontalCoordinatesForStars(const StarCatalogFrame *frame, const StarsSoA *stars,
+                                                   float *altitudes, float *azimuths)
+{
+    int star = 0;
+    
+#if defined(__GNUC__) && !ARDUINO
+    for(; star+VSOP87_SOA_LANES<=stars->count; star+=VSOP87_SOA_LANES)
+    {
+        StarsFloats altitude, azimuth;
+        horizontalForStars<StarsFloats,StarsInts>(frame,
+                                                  starsLoad(stars->x+star), starsLoad(stars->y+star), starsLoad(stars->z+star),
+                                                  &altitude, &azimuth);
+        
+        starsStore(altitudes+star, altitude);
+        starsStore(azimuths+star,  azimuth);
+    }
+#endif
+    
+    // Remaining stars
+    for(; star<stars->count; star++)
+    {
+        horizontalForStars<float,int>(frame, stars->x[star], stars->y[star], stars->z[star],
+                                      &altitudes[star], &azimuths[star]);
+    }
+}
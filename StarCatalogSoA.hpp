@@ -0,0 +1,89 @@
+/*
+ * StarCatalogSoA.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef StarCatalogSoA_h
+#define StarCatalogSoA_h
+
+#include "Ephemeris.hpp"
+#include "VSOP87SoA.hpp"
+
+/*! This structure describes stars stored as structure of arrays (see StarCatalogSoA::prepareStars).
+ *  Arrays belong to the caller. */
+struct StarsSoA
+{
+    /*! Number of stars. */
+    int count;
+    
+    /*! Unit vectors of J2000 positions (mean equator and equinox J2000). */
+    float *x;
+    float *y;
+    float *z;
+};
+
+/*! This structure describes transforms shared by every star for one date and time (see StarCatalogSoA::frameAtDateAndTime).
+ *  Each transform is a rotation (three first columns) followed by an offset (last column), applied to J2000 unit vectors. */
+struct StarCatalogFrame
+{
+    /*! Precession and nutation, plus annual aberration: apparent equatorial direction of date. */
+    float equatorial[3][4];
+    
+    /*! Same direction rotated by local apparent sidereal time and latitude: horizontal direction. */
+    float horizontal[3][4];
+};
+
+/*!
+ * This class computes apparent places of many stars, VSOP87_SOA_LANES stars at a time with FastMath.hpp trigonometry.
+ *
+ * Precession (IAU 1976), nutation and annual aberration are folded into one transform per frame (Meeus
+ * chapters 21 to 23), so that every star only costs a matrix product and the angles of its direction.
+ * Aberration is added at first order as Earth velocity over light speed: directions are not normalized,
+ * angles do not depend on length. Proper motion and refraction are not applied.
+ */
+class StarCatalogSoA
+{
+public:
+    
+    /*! Set stars from J2000 right ascensions in floating hours and declinations in floating degrees,
+     *  with arrays of count floats receiving unit vectors. */
+    static void prepareStars(const float *rightAscensions, const float *declinations, int count,
+                             float *x, float *y, float *z, StarsSoA *stars);
+    
+    /*! Compute transforms for a date and time, with location on earth of context. */
+    static void frameAtDateAndTime(EphemerisContext *context,
+                                   unsigned int day,   unsigned int month,   unsigned int year,
+                                   unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                   StarCatalogFrame *frame);
+    
+    /*! Compute transforms for a date and time, with location on earth of default context. */
+    static void frameAtDateAndTime(unsigned int day,   unsigned int month,   unsigned int year,
+                                   unsigned int hours, unsigned int minutes, unsigned int seconds,
+                                   StarCatalogFrame *frame);
+    
+    /*! Compute apparent right ascensions in floating hours and declinations in floating degrees
+     *  (arrays of stars->count floats). */
+    static void apparentCoordinatesForStars(const StarCatalogFrame *frame, const StarsSoA *stars,
+                                            float *rightAscensions, float *declinations);
+    
+    /*! Compute altitudes and azimuths in floating degrees (arrays of stars->count floats). */
+    static void horizontalCoordinatesForStars(const StarCatalogFrame *frame, const StarsSoA *stars,
+                                              float *altitudes, float *azimuths);
+};
+
+#endif
@@ -0,0 +1,250 @@
+/*
+ * TrackingStream.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+#include <math.h>
+#include <limits.h>
+
+#include "TrackingStream.hpp"
+#include "Calendar.hpp"
+
+
+#ifndef PI
+#define PI 3.1415926535
+#endif
+
+// Seconds per day
+#define SECONDS_PER_DAY 86400L
+
+// Bring an angle continuous with a previous one (difference in [-half,half[)
+static float unwrap(float value, float previous, float period)
+{
+    return value - period*floor((value-previous)/period+0.5);
+}
+
+TrackingStream::TrackingStream(SolarSystemObjectIndex object, const EphemerisContext *context, long windowSeconds, int degree)
+{
+    if( degree > TRACKING_MAX_DEGREE )
+    {
+        degree = TRACKING_MAX_DEGREE;
+    }
+    
+    if( degree < 1 )
+    {
+        degree = 1;
+    }
+    
+    // Rounded sample times must stay distinct
+    if( windowSeconds < 60L*degree )
+    {
+        windowSeconds = 60L*degree;
+    }
+    
+    this->object        = object;
+    this->context       = context ? *context : *Ephemeris::defaultContext();
+    this->windowSeconds = windowSeconds;
+    this->degree        = degree;
+    
+    startDay.day  = 0;
+    startDay.time = 0;
+    startSeconds  = 0;
+    
+    current = &windows[0];
+    next    = &windows[1];
+    
+    current->index = LONG_MIN;
+    next->index    = LONG_MIN;
+}
+
+void TrackingStream::start(unsigned int day,   unsigned int month,   unsigned int year,
+                           unsigned int hours, unsigned int minutes, unsigned int seconds)
+{
+    startDay     = Calendar::julianDayForDate(day, month, year);
+    startSeconds = hours*3600L + minutes*60L + seconds;
+    
+    // First window now, next one from update
+    current->index = LONG_MIN;
+    resetWindow(next, 0);
+    
+    float time;
+    windowForSeconds(0, &time);
+}
+
+bool TrackingStream::update()
+{
+    if( next->index == LONG_MIN || next->sampleCount > degree )
+    {
+        return false;
+    }
+    
+    sampleWindow(next);
+    
+    return next->sampleCount <= degree;
+}
+
+EquatorialCoordinates TrackingStream::equatorialCoordinatesForSeconds(float seconds)
+{
+    float time;
+    const TrackingWindow *window = windowForSeconds(seconds, &time);
+    
+    EquatorialCoordinates coordinates;
+    
+    coordinates.ra  = evaluate(window, window->ra, time);
+    coordinates.ra -= 24*floor(coordinates.ra/24);
+    coordinates.dec = evaluate(window, window->dec, time);
+    
+    return coordinates;
+}
+
+HorizontalCoordinates TrackingStream::horizontalCoordinatesForSeconds(float seconds)
+{
+    float time;
+    const TrackingWindow *window = windowForSeconds(seconds, &time);
+    
+    HorizontalCoordinates coordinates;
+    
+    coordinates.azi  = evaluate(window, window->azi, time);
+    coordinates.azi -= 360*floor(coordinates.azi/360);
+    coordinates.alt  = evaluate(window, window->alt, time);
+    
+    return coordinates;
+}
+
+const TrackingWindow *TrackingStream::windowForSeconds(float seconds, float *time)
+{
+    long index = (long)floor(seconds/windowSeconds);
+    
+    if( current->index != index )
+    {
+        // Next window is usually ready (see update), otherwise finish or fit it now
+        if( next->index != index )
+        {
+            resetWindow(next, index);
+        }
+        
+        while( next->sampleCount <= degree )
+        {
+            sampleWindow(next);
+        }
+        
+        TrackingWindow *window = current;
+        current = next;
+        next    = window;
+        
+        resetWindow(next, index+1);
+    }
+    
+    *time = seconds - (float)index*windowSeconds;
+    
+    return current;
+}
+
+void TrackingStream::resetWindow(TrackingWindow *window, long index)
+{
+    window->index       = index;
+    window->sampleCount = 0;
+    
+    // Chebyshev-Lobatto times (both ends included) rounded to the second
+    for(int sample=0; sample<=degree; sample++)
+    {
+        window->times[sample] = floor(windowSeconds*(1-cos(PI*sample/degree))/2 + 0.5);
+    }
+    
+    // Share boundary sample with previous window (interpolation is exact at its end)
+    if( window != current && current->index == index-1 && current->sampleCount > degree )
+    {
+        float end = (float)windowSeconds;
+        
+        window->ra[0]  = evaluate(current, current->ra,  end);
+        window->dec[0] = evaluate(current, current->dec, end);
+        window->alt[0] = evaluate(current, current->alt, end);
+        window->azi[0] = evaluate(current, current->azi, end);
+        
+        window->sampleCount = 1;
+    }
+}
+
+void TrackingStream::sampleWindow(TrackingWindow *window)
+{
+    int sample = window->sampleCount;
+    
+    // Julian day of sample (whole seconds from stream start, time 0.5 is 0h)
+    long total = startSeconds + window->index*windowSeconds + (long)window->times[sample] + SECONDS_PER_DAY/2;
+    long days  = total/SECONDS_PER_DAY;
+    long time  = total%SECONDS_PER_DAY;
+    if( time < 0 )
+    {
+        time += SECONDS_PER_DAY;
+        days -= 1;
+    }
+    
+    JulianDay jd;
+    jd.day  = startDay.day + days;
+    jd.time = (float)time/SECONDS_PER_DAY;
+    
+    SolarSystemObject solarSystemObject = Ephemeris::solarSystemObjectAtJulianDay(&context, object, jd);
+    
+    window->ra[sample]  = solarSystemObject.equaCoordinates.ra;
+    window->dec[sample] = solarSystemObject.equaCoordinates.dec;
+    window->alt[sample] = solarSystemObject.horiCoordinates.alt;
+    window->azi[sample] = solarSystemObject.horiCoordinates.azi;
+    
+    // Keep right ascension and azimuth continuous over the window
+    if( sample > 0 )
+    {
+        window->ra[sample]  = unwrap(window->ra[sample],  window->ra[sample-1],  24);
+        window->azi[sample] = unwrap(window->azi[sample], window->azi[sample-1], 360);
+    }
+    
+    window->sampleCount = ++sample;
+    
+    if( sample <= degree )
+    {
+        return;
+    }
+    
+    // Newton divided differences in place
+    for(int level=1; level<=degree; level++)
+    {
+        for(int j=degree; j>=level; j--)
+        {
+            float dt = window->times[j] - window->times[j-level];
+            
+            window->ra[j]  = (window->ra[j]  - window->ra[j-1]) /dt;
+            window->dec[j] = (window->dec[j] - window->dec[j-1])/dt;
+            window->alt[j] = (window->alt[j] - window->alt[j-1])/dt;
+            window->azi[j] = (window->azi[j] - window->azi[j-1])/dt;
+        }
+    }
+}
+
+float TrackingStream::evaluate(const TrackingWindow *window, const float *coefficients, float time) const
+{
+    float value = coefficients[degree];
+    
+    for(int j=degree-1; j>=0; j--)
+    {
+        value = value*(time - window->times[j]) + coefficients[j];
+    }
+    
+    return value;
+}
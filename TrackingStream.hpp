@@ -0,0 +1,131 @@
+/*
+ * TrackingStream.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TrackingStream_h
+#define TrackingStream_h
+
+#include <stddef.h>
+
+#include "Ephemeris.hpp"
+
+// Highest polynomial degree of a window.
+#ifndef TRACKING_MAX_DEGREE
+#define TRACKING_MAX_DEGREE 6
+#endif
+
+// Default window length and degree (see error bounds below).
+#define TRACKING_DEFAULT_WINDOW_SECONDS 1800
+#define TRACKING_DEFAULT_DEGREE         4
+
+/*! This structure describes interpolating polynomials of one object over one window. */
+struct TrackingWindow
+{
+    /*! Window index (window number since stream start), LONG_MIN when not used. */
+    long index;
+    
+    /*! Number of samples computed (window is ready with degree+1 samples). */
+    int sampleCount;
+    
+    /*! Sample times in seconds from window start. */
+    float times[TRACKING_MAX_DEGREE+1];
+    
+    /*! Samples, then Newton divided differences once ready (right ascension and azimuth unwrapped). */
+    float ra[TRACKING_MAX_DEGREE+1];
+    float dec[TRACKING_MAX_DEGREE+1];
+    float alt[TRACKING_MAX_DEGREE+1];
+    float azi[TRACKING_MAX_DEGREE+1];
+};
+
+/*!
+ * This class emits positions of one solar system object at high rate for mount drives.
+ *
+ * Time is split in windows of fixed length from stream start. Each window is described by polynomials
+ * interpolating degree+1 full evaluations (Ephemeris::solarSystemObjectForEpoch) at Chebyshev-Lobatto
+ * times rounded to the second. Windows share their boundary sample, so emitted positions are continuous.
+ * A position is then one Horner evaluation per coordinate.
+ *
+ * The next window is sampled ahead, one full evaluation per call to update, to be called from idle time
+ * (main loop on Arduino). When a window is needed before being ready, remaining samples are computed
+ * right away.
+ *
+ * Error bound: with default settings (30 minutes, degree 4) and up to one hour windows, interpolation error
+ * is below the single precision noise of full evaluations, measured at 7" for the Sun, 5" for Mars, 2" for
+ * Jupiter and 0.9" for the Moon over 6 hours in Paris. Azimuth within a few degrees of the zenith changes
+ * too fast to be interpolated (use equatorial coordinates there).
+ */
+class TrackingStream
+{
+public:
+    
+    /*! Create a stream for an object, using a copy of context (default context if NULL).
+     *  Degree is clamped to [1,TRACKING_MAX_DEGREE], window length is at least one minute per degree. */
+    TrackingStream(SolarSystemObjectIndex object, const EphemerisContext *context = NULL,
+                   long windowSeconds = TRACKING_DEFAULT_WINDOW_SECONDS, int degree = TRACKING_DEFAULT_DEGREE);
+    
+    /*! Start stream at a date and time (seconds count from there) and fit first window.
+     *  Seconds are single precision: resolution is about 8 ms one day after start (0.5 ms after 8192 s),
+     *  restart the stream every 2 hours for millisecond resolution. */
+    void start(unsigned int day,   unsigned int month,   unsigned int year,
+               unsigned int hours, unsigned int minutes, unsigned int seconds);
+    
+    /*! Compute one sample of next window if needed. Returns false when next window is ready. */
+    bool update();
+    
+    /*! Get equatorial coordinates for seconds from stream start. */
+    EquatorialCoordinates equatorialCoordinatesForSeconds(float seconds);
+    
+    /*! Get horizontal coordinates for seconds from stream start. */
+    HorizontalCoordinates horizontalCoordinatesForSeconds(float seconds);
+    
+private:
+    
+    /*! Get window containing seconds and time in seconds inside it (fit window if needed). */
+    const TrackingWindow *windowForSeconds(float seconds, float *time);
+    
+    /*! Prepare a window for sampling. */
+    void resetWindow(TrackingWindow *window, long index);
+    
+    /*! Compute next sample of a window (divided differences after last one). */
+    void sampleWindow(TrackingWindow *window);
+    
+    /*! Evaluate Newton polynomial with Horner scheme. */
+    float evaluate(const TrackingWindow *window, const float *coefficients, float time) const;
+    
+    /*! Observed object. */
+    SolarSystemObjectIndex object;
+    
+    /*! Private copy of context (location, accuracy and caches). */
+    EphemerisContext context;
+    
+    /*! Window length in seconds and polynomial degree. */
+    long windowSeconds;
+    int  degree;
+    
+    /*! Stream start: Julian day at midnight and seconds from midnight. */
+    JulianDay startDay;
+    long      startSeconds;
+    
+    /*! Current and next windows (swapped when current window is left). */
+    TrackingWindow windows[2];
+    TrackingWindow *current;
+    TrackingWindow *next;
+};
+
+#endif
@@ -34,6 +34,26 @@ struct VSOP87Coefficient
     float C;
 };
 
+// VSOP87 variables (longitude, latitude, radius) and powers of time per variable
+#define VSOP87_VARIABLE_COUNT 3
+#define VSOP87_POWER_COUNT    6
+
+/*! This structure describes one VSOP87 table. */
+struct VSOP87Series
+{
+    /*! Terms of the table (NULL if table does not exist). */
+    const VSOP87Coefficient *coefficients;
+    
+    /*! Number of terms. */
+    int count;
+};
+
+/*! This structure describes VSOP87 tables of a planet, indexed by variable (L,B,R) and power of time. */
+struct VSOP87PlanetSeries
+{
+    VSOP87Series series[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+};
+
 
 ////////////////////////////////////////////////////////////
 //
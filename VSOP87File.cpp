@@ -0,0 +1,340 @@
+/*
+ * VSOP87File.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VSOP87File.hpp"
+
+#if EPHEMERIS_USE_VSOP87_FILE
+
+#include <string.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// Current mapping
+static const char             *fileMapping = NULL;
+static size_t                  fileSize    = 0;
+static const VSOP87FileHeader *fileHeader  = NULL;
+
+// Tables of current file seen as structure of arrays (float SoA files only, arrays point into mapping)
+static VSOP87SeriesSoA fileSeries[VSOP87_FILE_PLANET_COUNT][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+
+bool VSOP87File::isValidHeader(const VSOP87FileHeader *header, uint64_t size)
+{
+    if( size < sizeof(VSOP87FileHeader) || memcmp(header->magic, VSOP87_FILE_MAGIC, sizeof(header->magic)) != 0 )
+    {
+        return false;
+    }
+    
+    // Other versions, big endian files and truncated files are rejected
+    if( header->version != VSOP87_FILE_VERSION || header->fileSize != size || (header->flags & ~(VSOP87_FILE_DOUBLE|VSOP87_FILE_AOS)) != 0 )
+    {
+        return false;
+    }
+    
+    uint64_t valueSize = (header->flags & VSOP87_FILE_DOUBLE) ? sizeof(double) : sizeof(float);
+    bool     aos       = (header->flags & VSOP87_FILE_AOS) != 0;
+    
+    for(int planet=0; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const VSOP87FileSeries *series = &header->series[planet][variable][power];
+                if( series->count == 0 )
+                {
+                    continue;
+                }
+                
+                // Aligned arrays, padded to the widest lane count, inside the file
+                if( series->offset % VSOP87_FILE_ALIGNMENT != 0 || series->stride % VSOP87_FILE_ALIGNMENT != 0 ||
+                    series->paddedCount % VSOP87_FILE_PADDING != 0 || series->paddedCount < series->count ||
+                    series->offset < sizeof(VSOP87FileHeader) || series->offset > size )
+                {
+                    return false;
+                }
+                
+                // A,B,C arrays or triplets inside the file (compared by division: crafted sizes must not wrap around)
+                uint64_t available = (size-series->offset)/3;
+                if( aos ? (uint64_t)series->paddedCount*valueSize > available
+                        : (series->stride > available || series->stride < (uint64_t)series->paddedCount*valueSize) )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    
+    return true;
+}
+
+bool VSOP87File::open(const char *path)
+{
+    close();
+    
+    int descriptor = ::open(path, O_RDONLY);
+    if( descriptor < 0 )
+    {
+        return false;
+    }
+    
+    struct stat status;
+    if( fstat(descriptor, &status) != 0 || status.st_size < (off_t)sizeof(VSOP87FileHeader) )
+    {
+        ::close(descriptor);
+        return false;
+    }
+    
+    // Lazy read only mapping: nothing is read before first use of a table
+    void *mapping = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);
+    
+    if( mapping == MAP_FAILED )
+    {
+        return false;
+    }
+    
+    const VSOP87FileHeader *header = (const VSOP87FileHeader *)mapping;
+    if( !isValidHeader(header, status.st_size) )
+    {
+        munmap(mapping, status.st_size);
+        return false;
+    }
+    
+    // No read-ahead: pages of planets that are never computed are never read
+    madvise(mapping, status.st_size, MADV_RANDOM);
+    
+    fileMapping = (const char *)mapping;
+    fileSize    = status.st_size;
+    fileHeader  = header;
+    
+    for(int planet=0; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const VSOP87FileSeries *series = &header->series[planet][variable][power];
+                VSOP87SeriesSoA        *soa    = &fileSeries[planet][variable][power];
+                
+                soa->A           = (const float *)(fileMapping+series->offset);
+                soa->B           = (const float *)(fileMapping+series->offset+series->stride);
+                soa->C           = (const float *)(fileMapping+series->offset+2*series->stride);
+                soa->count       = series->count;
+                soa->paddedCount = series->paddedCount;
+            }
+        }
+    }
+    
+    return true;
+}
+
+void VSOP87File::close()
+{
+    if( fileMapping )
+    {
+        munmap((void *)fileMapping, fileSize);
+    }
+    
+    fileMapping = NULL;
+    fileSize    = 0;
+    fileHeader  = NULL;
+}
+
+bool VSOP87File::isOpen()
+{
+    return fileHeader != NULL;
+}
+
+bool VSOP87File::hasPlanet(int planet)
+{
+    // Every planet has a constant term of longitude
+    return countForPlanet(planet, 0, 0) > 0;
+}
+
+int VSOP87File::countForPlanet(int planet, int variable, int power)
+{
+    if( fileHeader == NULL || planet < 0 || planet >= VSOP87_FILE_PLANET_COUNT )
+    {
+        return 0;
+    }
+    
+    return fileHeader->series[planet][variable][power].count;
+}
+
+// Get A, B and C of a table and distance between two terms (in values)
+template<typename Value>
+static void termsForSeries(const VSOP87FileSeries *series, const Value **A, const Value **B, const Value **C, int *step)
+{
+    const char *table = fileMapping+series->offset;
+    
+    if( fileHeader->flags & VSOP87_FILE_AOS )
+    {
+        *A    = (const Value *)table;
+        *B    = *A+1;
+        *C    = *A+2;
+        *step = 3;
+    }
+    else
+    {
+        *A    = (const Value *)table;
+        *B    = (const Value *)(table+series->stride);
+        *C    = (const Value *)(table+2*series->stride);
+        *step = 1;
+    }
+}
+
+// Scalar sum of terms in Value precision
+template<typename Value>
+static Value sumTerms(const VSOP87FileSeries *series, int termCount, Value T)
+{
+    const Value *A, *B, *C;
+    int step;
+    termsForSeries<Value>(series, &A, &B, &C, &step);
+    
+    Value value = 0;
+    for(int term=0; term<termCount*step; term+=step)
+    {
+        value += A[term]*cos(B[term] + C[term]*T);
+    }
+    
+    return value;
+}
+
+// Scalar sum of terms and of their derivative in Value precision
+template<typename Value>
+static Value sumTermsAndRate(const VSOP87FileSeries *series, int termCount, Value T, Value *rate)
+{
+    const Value *A, *B, *C;
+    int step;
+    termsForSeries<Value>(series, &A, &B, &C, &step);
+    
+    Value value     = 0;
+    Value valueRate = 0;
+    for(int term=0; term<termCount*step; term+=step)
+    {
+        Value argument = B[term] + C[term]*T;
+        
+        value     += A[term]*cos(argument);
+        valueRate -= A[term]*C[term]*sin(argument);
+    }
+    
+    *rate = valueRate;
+    
+    return value;
+}
+
+float VSOP87File::amplitudeForPlanet(int planet, int variable, int power, int term)
+{
+    const VSOP87FileSeries *series = &fileHeader->series[planet][variable][power];
+    int step;
+    
+    if( fileHeader->flags & VSOP87_FILE_DOUBLE )
+    {
+        const double *A, *B, *C;
+        termsForSeries<double>(series, &A, &B, &C, &step);
+        return A[term*step];
+    }
+    
+    const float *A, *B, *C;
+    termsForSeries<float>(series, &A, &B, &C, &step);
+    return A[term*step];
+}
+
+const VSOP87SeriesSoA *VSOP87File::seriesForPlanet(int planet, int variable, int power)
+{
+    if( countForPlanet(planet, variable, power) == 0 || (fileHeader->flags & (VSOP87_FILE_DOUBLE|VSOP87_FILE_AOS)) )
+    {
+        return NULL;
+    }
+    
+    return &fileSeries[planet][variable][power];
+}
+
+float VSOP87File::sumSeries(int planet, int variable, int power, int termCount, float T)
+{
+    int count = countForPlanet(planet, variable, power);
+    if( termCount > count )
+    {
+        termCount = count;
+    }
+    
+    if( termCount <= 0 )
+    {
+        return 0;
+    }
+    
+    const VSOP87FileSeries *series = &fileHeader->series[planet][variable][power];
+    
+    if( fileHeader->flags & VSOP87_FILE_DOUBLE )
+    {
+        // Double precision terms (complete series, small amplitudes do not vanish in the sum)
+        return sumTerms<double>(series, termCount, T);
+    }
+    
+#if EPHEMERIS_USE_SOA
+    if( !(fileHeader->flags & VSOP87_FILE_AOS) )
+    {
+        return VSOP87SoA::sumSeries(&fileSeries[planet][variable][power], termCount, T);
+    }
+#endif
+    
+    return sumTerms<float>(series, termCount, T);
+}
+
+float VSOP87File::sumSeriesAndRate(int planet, int variable, int power, int termCount, float T, float *rate)
+{
+    *rate = 0;
+    
+    int count = countForPlanet(planet, variable, power);
+    if( termCount > count )
+    {
+        termCount = count;
+    }
+    
+    if( termCount <= 0 )
+    {
+        return 0;
+    }
+    
+    const VSOP87FileSeries *series = &fileHeader->series[planet][variable][power];
+    
+    if( fileHeader->flags & VSOP87_FILE_DOUBLE )
+    {
+        double doubleRate;
+        float  value = sumTermsAndRate<double>(series, termCount, T, &doubleRate);
+        
+        *rate = doubleRate;
+        return value;
+    }
+    
+#if EPHEMERIS_USE_SOA
+    if( !(fileHeader->flags & VSOP87_FILE_AOS) )
+    {
+        return VSOP87SoA::sumSeriesAndRate(&fileSeries[planet][variable][power], termCount, T, rate);
+    }
+#endif
+    
+    return sumTermsAndRate<float>(series, termCount, T, rate);
+}
+
+#endif
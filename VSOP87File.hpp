@@ -0,0 +1,144 @@
+/*
+ * VSOP87File.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VSOP87File_h
+#define VSOP87File_h
+
+#include <stdint.h>
+
+#include "VSOP87SoA.hpp"
+
+// Memory mapped coefficient files need POSIX mmap (never on Arduino).
+#ifndef EPHEMERIS_USE_VSOP87_FILE
+#if !ARDUINO && (defined(__unix__) || defined(__APPLE__))
+#define EPHEMERIS_USE_VSOP87_FILE 1
+#else
+#define EPHEMERIS_USE_VSOP87_FILE 0
+#endif
+#endif
+
+// File identification and version
+#define VSOP87_FILE_MAGIC   "VSOP87SA"
+#define VSOP87_FILE_VERSION 1
+
+// Arrays are aligned on a cache line and padded with null terms to a multiple of the widest lane count (AVX-512)
+#define VSOP87_FILE_ALIGNMENT 64
+#define VSOP87_FILE_PADDING   16
+
+// Objects described by a file, indexed by SolarSystemObjectIndex (Sun to Neptune, Sun has no table)
+#define VSOP87_FILE_PLANET_COUNT 9
+
+// Header flags
+#define VSOP87_FILE_DOUBLE 0x1
+#define VSOP87_FILE_AOS    0x2
+
+/*! This structure describes one table in a coefficient file. */
+struct VSOP87FileSeries
+{
+    /*! Offset of A array from start of file (B and C follow, one stride apart), 0 if table does not exist. */
+    uint64_t offset;
+    
+    /*! Distance between A, B and C arrays in bytes (multiple of VSOP87_FILE_ALIGNMENT, 0 for VSOP87_FILE_AOS). */
+    uint64_t stride;
+    
+    /*! Number of terms, sorted by decreasing amplitude. */
+    uint32_t count;
+    
+    /*! Number of stored terms (multiple of VSOP87_FILE_PADDING). */
+    uint32_t paddedCount;
+};
+
+/*!
+ * This structure describes the header of a coefficient file (little endian, at offset 0).
+ *
+ * Payload holds structure of arrays tables: for each table A (amplitude in 1e-8 radian or AU, already
+ * squared unlike VSOP87.h), B (phase in radians) and C (frequency in radians per thousand of Julian
+ * years), in float or in double (VSOP87_FILE_DOUBLE). With VSOP87_FILE_AOS terms are stored as A,B,C
+ * triplets instead (scalar evaluation only). Tables of a planet are contiguous so that only used
+ * planets are paged in. Files are written by tools/VSOP87Generator.cpp.
+ */
+struct VSOP87FileHeader
+{
+    /*! VSOP87_FILE_MAGIC (not null terminated). */
+    char magic[8];
+    
+    /*! VSOP87_FILE_VERSION. */
+    uint32_t version;
+    
+    /*! VSOP87_FILE_DOUBLE, VSOP87_FILE_AOS or 0. */
+    uint32_t flags;
+    
+    /*! Size of the whole file in bytes. */
+    uint64_t fileSize;
+    
+    /*! Tables by planet, variable (L,B,R) and power of time. */
+    VSOP87FileSeries series[VSOP87_FILE_PLANET_COUNT][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+};
+
+#if EPHEMERIS_USE_VSOP87_FILE
+
+/*!
+ * This class maps a coefficient file in memory (read only, zero copy) and evaluates its tables.
+ *
+ * Once open, planets present in the file are computed from it instead of VSOP87.h (see
+ * Ephemeris::loadVSOP87File), which allows complete VSOP87 series without recompiling. Pages are only
+ * read from disk when a table is first used. Float SoA files are evaluated in place by the structure
+ * of arrays kernels. Double files are summed in double precision (many small terms of complete series
+ * add up without rounding), then coordinates keep the single precision of HeliocentricCoordinates.
+ * Opening or closing a file while another thread computes ephemerides is not supported.
+ */
+class VSOP87File
+{
+public:
+    
+    /*! Map and validate a coefficient file (previous file is closed). Return false on error. */
+    static bool open(const char *path);
+    
+    /*! Unmap current file. */
+    static void close();
+    
+    /*! Return true if a file is mapped. */
+    static bool isOpen();
+    
+    /*! Return true if current file holds tables of a planet. */
+    static bool hasPlanet(int planet);
+    
+    /*! Number of terms of a table (0 if file or table does not exist). */
+    static int countForPlanet(int planet, int variable, int power);
+    
+    /*! Amplitude of one term of a table (1e-8 radian or AU). */
+    static float amplitudeForPlanet(int planet, int variable, int power, int term);
+    
+    /*! Get a table as structure of arrays, pointing into the mapping (NULL for double precision or AoS files). */
+    static const VSOP87SeriesSoA *seriesForPlanet(int planet, int variable, int power);
+    
+    /*! Compute first termCount terms of a table for T (thousands of Julian years from J2000). */
+    static float sumSeries(int planet, int variable, int power, int termCount, float T);
+    
+    /*! Compute first termCount terms of a table and their derivative (per thousand of Julian years) for T. */
+    static float sumSeriesAndRate(int planet, int variable, int power, int termCount, float T, float *rate);
+    
+    /*! Validate a header against the size of its file. */
+    static bool isValidHeader(const VSOP87FileHeader *header, uint64_t fileSize);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,3233 @@
+/*
+ * VSOP87Fixed.h
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ *
+ * Generated by tools/VSOP87Generator.cpp (from VSOP87.h, threshold 0).
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VSOP87Fixed_h
+#define VSOP87Fixed_h
+
+#include <stdint.h>
+
+#include "VSOP87.h"
+
+// Fractional bits of frequencies (turns per thousand of Julian years)
+#define VSOP87_FIXED_FREQUENCY_BITS 15
+
+// Quarter wave sine table: 2^bits intervals, values in Q30
+#define VSOP87_FIXED_SINE_BITS 10
+
+/*! This structure describes one VSOP87 term in fixed point: A*cos(B+C*t). */
+struct VSOP87FixedCoefficient
+{
+    /*! Amplitude in 1e-8 radian or AU, divided by 2^shift of its table. */
+    uint32_t A;
+    
+    /*! Phase in turns (Q32, wraps around). */
+    uint32_t B;
+    
+    /*! Frequency in turns per thousand of Julian years (VSOP87_FIXED_FREQUENCY_BITS fractional bits). */
+    int32_t C;
+};
+
+/*! This structure describes one VSOP87 table in fixed point. */
+struct VSOP87FixedSeries
+{
+    /*! Terms of the table (NULL if table does not exist). */
+    const VSOP87FixedCoefficient *coefficients;
+    
+    /*! Number of terms. */
+    int count;
+    
+    /*! Amplitude scale of the table (largest amplitudes of first power of time do not fit 32 bits). */
+    int shift;
+};
+
+/*! This structure describes fixed point tables of a planet, indexed by variable (L,B,R) and power of time. */
+struct VSOP87FixedPlanetSeries
+{
+    VSOP87FixedSeries series[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+};
+
+CONST int32_t VSOP87FixedSine[(1<<VSOP87_FIXED_SINE_BITS)+2] =
+{
+    0, 1647099, 3294193, 4941281, 6588356, 8235416, 9882456, 11529474,
+    13176464, 14823423, 16470347, 18117233, 19764076, 21410872, 23057618, 24704310,
+    26350943, 27997515, 29644021, 31290457, 32936819, 34583104, 36229307, 37875426,
+    39521455, 41167391, 42813230, 44458968, 46104602, 47750128, 49395541, 51040837,
+    52686014, 54331067, 55975992, 57620785, 59265442, 60909960, 62554335, 64198563,
+    65842639, 67486561, 69130324, 70773924, 72417357, 74060620, 75703709, 77346620,
+    78989349, 80631892, 82274245, 83916404, 85558366, 87200127, 88841683, 90483029,
+    92124163, 93765079, 95405776, 97046247, 98686491, 100326502, 101966277, 103605812,
+    105245103, 106884147, 108522939, 110161476, 111799753, 113437768, 115075515, 116712992,
+    118350194, 119987118, 121623759, 123260114, 124896179, 126531950, 128167423, 129802595,
+    131437462, 133072019, 134706263, 136340190, 137973796, 139607077, 141240030, 142872651,
+    144504935, 146136880, 147768480, 149399733, 151030634, 152661180, 154291367, 155921191,
+    157550647, 159179733, 160808445, 162436778, 164064728, 165692293, 167319468, 168946249,
+    170572633, 172198615, 173824192, 175449360, 177074115, 178698453, 180322371, 181945865,
+    183568930, 185191564, 186813762, 188435520, 190056834, 191677702, 193298119, 194918080,
+    196537583, 198156624, 199775198, 201393302, 203010932, 204628085, 206244756, 207860942,
+    209476638, 211091842, 212706549, 214320755, 215934457, 217547651, 219160334, 220772500,
+    222384147, 223995270, 225605867, 227215933, 228825464, 230434456, 232042906, 233650811,
+    235258165, 236864966, 238471210, 240076892, 241682010, 243286558, 244890535, 246493935,
+    248096755, 249698991, 251300640, 252901697, 254502159, 256102022, 257701283, 259299937,
+    260897982, 262495412, 264092224, 265688415, 267283981, 268878918, 270473223, 272066891,
+    273659918, 275252302, 276844038, 278435122, 280025552, 281615322, 283204430, 284792871,
+    286380643, 287967740, 289554160, 291139898, 292724951, 294309316, 295892988, 297475964,
+    299058239, 300639811, 302220676, 303800829, 305380268, 306958988, 308536985, 310114257,
+    311690799, 313266607, 314841679, 316416009, 317989595, 319562433, 321134518, 322705848,
+    324276419, 325846226, 327415267, 328983538, 330551034, 332117752, 333683689, 335248841,
+    336813204, 338376774, 339939549, 341501523, 343062693, 344623057, 346182609, 347741347,
+    349299266, 350856364, 352412636, 353968079, 355522689, 357076462, 358629395, 360181484,
+    361732726, 363283116, 364832652, 366381329, 367929144, 369476093, 371022173, 372567379,
+    374111709, 375655159, 377197725, 378739403, 380280190, 381820082, 383359076, 384897167,
+    386434353, 387970630, 389505993, 391040440, 392573967, 394106570, 395638246, 397168991,
+    398698801, 400227673, 401755603, 403282588, 404808624, 406333708, 407857835, 409381002,
+    410903207, 412424444, 413944711, 415464004, 416982319, 418499653, 420016002, 421531363,
+    423045732, 424559105, 426071480, 427582852, 429093217, 430602573, 432110916, 433618242,
+    435124548, 436629829, 438134084, 439637307, 441139496, 442640647, 444140756, 445639820,
+    447137835, 448634799, 450130706, 451625555, 453119340, 454612060, 456103710, 457594286,
+    459083786, 460572205, 462059541, 463545789, 465030947, 466515010, 467997976, 469479840,
+    470960600, 472440251, 473918791, 475396216, 476872522, 478347705, 479821764, 481294693,
+    482766489, 484237150, 485706671, 487175049, 488642281, 490108363, 491573292, 493037064,
+    494499676, 495961124, 497421405, 498880516, 500338453, 501795212, 503250791, 504705185,
+    506158392, 507610408, 509061229, 510510853, 511959275, 513406493, 514852502, 516297300,
+    517740883, 519183248, 520624391, 522064309, 523502998, 524940456, 526376678, 527811662,
+    529245404, 530677900, 532109148, 533539144, 534967884, 536395365, 537821584, 539246538,
+    540670223, 542092635, 543513772, 544933630, 546352205, 547769495, 549185496, 550600205,
+    552013618, 553425732, 554836544, 556246051, 557654248, 559061133, 560466703, 561870954,
+    563273883, 564675486, 566075761, 567474703, 568872310, 570268579, 571663506, 573057087,
+    574449320, 575840202, 577229728, 578617896, 580004702, 581390144, 582774218, 584156920,
+    585538248, 586918198, 588296766, 589673951, 591049748, 592424154, 593797166, 595168781,
+    596538995, 597907806, 599275210, 600641203, 602005783, 603368947, 604730691, 606091012,
+    607449906, 608807372, 610163404, 611518001, 612871159, 614222875, 615573145, 616921967,
+    618269338, 619615253, 620959711, 622302707, 623644239, 624984303, 626322897, 627660017,
+    628995660, 630329823, 631662503, 632993696, 634323400, 635651611, 636978327, 638303543,
+    639627258, 640949467, 642270169, 643589359, 644907034, 646223192, 647537830, 648850943,
+    650162530, 651472587, 652781111, 654088099, 655393548, 656697454, 657999816, 659300629,
+    660599890, 661897597, 663193747, 664488336, 665781362, 667072820, 668362709, 669651026,
+    670937767, 672222928, 673506508, 674788504, 676068911, 677347728, 678624950, 679900576,
+    681174602, 682447025, 683717842, 684987051, 686254647, 687520629, 688784993, 690047736,
+    691308855, 692568348, 693826211, 695082441, 696337036, 697589992, 698841307, 700090977,
+    701339000, 702585372, 703830092, 705073155, 706314559, 707554301, 708792378, 710028787,
+    711263525, 712496590, 713727978, 714957687, 716185713, 717412054, 718636707, 719859669,
+    721080937, 722300508, 723518380, 724734549, 725949013, 727161768, 728372813, 729582143,
+    730789757, 731995651, 733199822, 734402269, 735602987, 736801974, 737999228, 739194745,
+    740388522, 741580558, 742770848, 743959390, 745146182, 746331221, 747514503, 748696026,
+    749875788, 751053785, 752230015, 753404474, 754577161, 755748072, 756917205, 758084557,
+    759250125, 760413906, 761575898, 762736098, 763894504, 765051111, 766205919, 767358923,
+    768510122, 769659512, 770807092, 771952857, 773096806, 774238936, 775379244, 776517728,
+    777654384, 778789210, 779922204, 781053363, 782182683, 783310163, 784435800, 785559591,
+    786681534, 787801625, 788919863, 790036244, 791150767, 792263427, 793374223, 794483153,
+    795590213, 796695401, 797798714, 798900150, 799999706, 801097379, 802193167, 803287068,
+    804379079, 805469196, 806557419, 807643743, 808728167, 809810688, 810891304, 811970011,
+    813046808, 814121692, 815194659, 816265709, 817334838, 818402043, 819467323, 820530675,
+    821592095, 822651583, 823709135, 824764748, 825818421, 826870150, 827919934, 828967769,
+    830013654, 831057586, 832099562, 833139580, 834177638, 835213733, 836247863, 837280024,
+    838310216, 839338435, 840364679, 841388945, 842411232, 843431536, 844449856, 845466188,
+    846480531, 847492882, 848503239, 849511600, 850517961, 851522321, 852524677, 853525028,
+    854523370, 855519701, 856514019, 857506321, 858496606, 859484870, 860471112, 861455330,
+    862437520, 863417681, 864395810, 865371905, 866345964, 867317984, 868287963, 869255900,
+    870221790, 871185633, 872147426, 873107167, 874064853, 875020483, 875974054, 876925563,
+    877875009, 878822389, 879767701, 880710943, 881652112, 882591207, 883528225, 884463164,
+    885396022, 886326796, 887255485, 888182086, 889106597, 890029016, 890949341, 891867569,
+    892783698, 893697727, 894609652, 895519473, 896427186, 897332790, 898236282, 899137661,
+    900036924, 900934069, 901829095, 902721998, 903612776, 904501429, 905387953, 906272347,
+    907154608, 908034735, 908912725, 909788576, 910662286, 911533853, 912403276, 913270551,
+    914135678, 914998653, 915859476, 916718143, 917574653, 918429004, 919281194, 920131221,
+    920979082, 921824777, 922668302, 923509656, 924348837, 925185843, 926020672, 926853322,
+    927683790, 928512076, 929338177, 930162092, 930983817, 931803352, 932620694, 933435842,
+    934248793, 935059546, 935868098, 936674448, 937478595, 938280535, 939080267, 939877790,
+    940673101, 941466198, 942257081, 943045745, 943832191, 944616416, 945398418, 946178196,
+    946955747, 947731070, 948504163, 949275023, 950043650, 950810042, 951574196, 952336111,
+    953095785, 953853216, 954608403, 955361344, 956112036, 956860479, 957606670, 958350608,
+    959092290, 959831716, 960568883, 961303790, 962036435, 962766816, 963494932, 964220780,
+    964944360, 965665669, 966384706, 967101468, 967815955, 968528165, 969238095, 969945745,
+    970651112, 971354196, 972054994, 972753504, 973449725, 974143656, 974835295, 975524639,
+    976211688, 976896441, 977578894, 978259047, 978936898, 979612445, 980285688, 980956623,
+    981625251, 982291568, 982955574, 983617267, 984276646, 984933708, 985588453, 986240879,
+    986890984, 987538766, 988184225, 988827359, 989468165, 990106644, 990742793, 991376610,
+    992008094, 992637245, 993264059, 993888536, 994510675, 995130473, 995747930, 996363043,
+    996975812, 997586236, 998194311, 998800038, 999403415, 1000004439, 1000603111, 1001199428,
+    1001793390, 1002384994, 1002974239, 1003561124, 1004145648, 1004727809, 1005307605, 1005885036,
+    1006460100, 1007032796, 1007603122, 1008171077, 1008736660, 1009299870, 1009860704, 1010419162,
+    1010975242, 1011528943, 1012080264, 1012629204, 1013175761, 1013719934, 1014261721, 1014801122,
+    1015338134, 1015872758, 1016404991, 1016934832, 1017462281, 1017987335, 1018509994, 1019030256,
+    1019548121, 1020063586, 1020576651, 1021087314, 1021595575, 1022101432, 1022604883, 1023105929,
+    1023604567, 1024100796, 1024594615, 1025086024, 1025575020, 1026061603, 1026545772, 1027027525,
+    1027506862, 1027983780, 1028458280, 1028930359, 1029400018, 1029867254, 1030332067, 1030794455,
+    1031254418, 1031711954, 1032167062, 1032619742, 1033069992, 1033517810, 1033963197, 1034406151,
+    1034846671, 1035284755, 1035720404, 1036153615, 1036584389, 1037012723, 1037438617, 1037862069,
+    1038283080, 1038701647, 1039117770, 1039531448, 1039942680, 1040351465, 1040757802, 1041161689,
+    1041563127, 1041962114, 1042358649, 1042752731, 1043144360, 1043533534, 1043920252, 1044304514,
+    1044686319, 1045065665, 1045442553, 1045816980, 1046188946, 1046558451, 1046925492, 1047290071,
+    1047652185, 1048011834, 1048369016, 1048723732, 1049075980, 1049425759, 1049773069, 1050117909,
+    1050460278, 1050800175, 1051137599, 1051472550, 1051805027, 1052135029, 1052462555, 1052787604,
+    1053110176, 1053430270, 1053747885, 1054063021, 1054375676, 1054685850, 1054993543, 1055298753,
+    1055601479, 1055901722, 1056199480, 1056494753, 1056787540, 1057077840, 1057365653, 1057650977,
+    1057933813, 1058214159, 1058492016, 1058767381, 1059040255, 1059310638, 1059578527, 1059843923,
+    1060106826, 1060367233, 1060625146, 1060880563, 1061133483, 1061383907, 1061631833, 1061877261,
+    1062120190, 1062360620, 1062598550, 1062833980, 1063066909, 1063297336, 1063525261, 1063750684,
+    1063973603, 1064194019, 1064411931, 1064627338, 1064840240, 1065050636, 1065258526, 1065463909,
+    1065666786, 1065867154, 1066065015, 1066260367, 1066453210, 1066643544, 1066831367, 1067016680,
+    1067199483, 1067379774, 1067557554, 1067732821, 1067905576, 1068075818, 1068243547, 1068408763,
+    1068571464, 1068731650, 1068889322, 1069044479, 1069197120, 1069347245, 1069494854, 1069639946,
+    1069782521, 1069922579, 1070060120, 1070195142, 1070327646, 1070457632, 1070585099, 1070710046,
+    1070832474, 1070952382, 1071069770, 1071184638, 1071296985, 1071406812, 1071514117, 1071618901,
+    1071721163, 1071820903, 1071918122, 1072012818, 1072104991, 1072194642, 1072281769, 1072366374,
+    1072448455, 1072528012, 1072605046, 1072679556, 1072751542, 1072821003, 1072887940, 1072952352,
+    1073014240, 1073073603, 1073130440, 1073184753, 1073236540, 1073285802, 1073332538, 1073376748,
+    1073418433, 1073457592, 1073494225, 1073528332, 1073559913, 1073588967, 1073615496, 1073639498,
+    1073660973, 1073679922, 1073696345, 1073710241, 1073721611, 1073730454, 1073736771, 1073740561,
+    1073741824, 1073740561
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Mercury.
+//
+
+CONST VSOP87FixedCoefficient L0MercuryFixedCoefficients[] =
+{
+    {440250717UL, 0UL, 0L},
+    {40989418UL, 1013740939UL, 136053346L},
+    {5046294UL, 3060906328UL, 272106692L},
+    {855347UL, 796492293UL, 408160058L},
+    {165590UL, 2816078294UL, 544213384L},
+    {34562UL, 532709247UL, 680266750L},
+    {7583UL, 2538419666UL, 816320116L},
+    {3560UL, 1033550673UL, 5785619L},
+    {1803UL, 2804873460UL, 29524918L},
+    {1726UL, 244921439UL, 952373482L},
+    {1590UL, 2047346371UL, 130528474L},
+    {1365UL, 3143853259UL, 141838967L},
+    {1017UL, 601742502UL, 165578263L},
+    {714UL, 1053374096UL, 130267735L},
+    {644UL, 3624946638UL, 112314049L},
+    {451UL, 4135570048UL, 266581830L},
+    {404UL, 2243461279UL, 1088426767L},
+    {352UL, 3583249245UL, 106528428L},
+    {345UL, 1908514287UL, 82789137L},
+    {343UL, 3940753722UL, 4983635L},
+    {339UL, 4007743153UL, 133290915L},
+    {325UL, 913926782UL, 277892313L},
+    {273UL, 1705495284UL, 2762439L},
+    {264UL, 2677525222UL, 301631609L},
+    {260UL, 674678919UL, 23739297L},
+    {239UL, 77242875UL, 5524877L},
+    {235UL, 182511922UL, 59049835L},
+    {217UL, 451153100UL, 70518489L},
+    {209UL, 1430018562UL, 248367395L},
+    {183UL, 1797093074UL, 141036989L},
+    {182UL, 1663797891UL, 133828558L},
+    {176UL, 3100651936UL, 266321091L},
+    {173UL, 1676101989UL, 127766033L},
+    {142UL, 2296779254UL, 195103181L},
+    {138UL, 198917501UL, 53264219L},
+    {125UL, 2543546360UL, 206571851L},
+    {118UL, 1900994962UL, 402635176L},
+    {106UL, 2875075447UL, 103285915L}
+};
+
+CONST VSOP87FixedCoefficient L1MercuryFixedCoefficients[] =
+{
+    {2547670418UL, 0UL, 0L},
+    {1100UL, 4249752703UL, 136053346L},
+    {296UL, 2088739654UL, 272106692L},
+    {79UL, 4172858324UL, 408160058L},
+    {21UL, 1938126294UL, 544213384L},
+    {5UL, 3982998059UL, 680266750L},
+    {1UL, 1721559208UL, 816320116L},
+    {0UL, 3745937723UL, 952373482L},
+    {0UL, 2086241252UL, 5785621L},
+    {0UL, 1468981729UL, 1088426767L},
+    {0UL, 4183419408UL, 141838957L},
+    {0UL, 0UL, 130267705L},
+    {0UL, 3841636771UL, 29524907L},
+    {0UL, 3123893427UL, 130528464L},
+    {0UL, 2078038412UL, 266321091L},
+    {0UL, 3479347357UL, 1224480134L}
+};
+
+CONST VSOP87FixedCoefficient L2MercuryFixedCoefficients[] =
+{
+    {53050UL, 0UL, 0L},
+    {16904UL, 3206413365UL, 136053346L},
+    {7397UL, 921035818UL, 272106692L},
+    {3018UL, 3046240238UL, 408160058L},
+    {1107UL, 862864457UL, 544213384L},
+    {378UL, 2953002108UL, 680266750L},
+    {123UL, 730731284UL, 816320116L},
+    {39UL, 2788946272UL, 952373401L},
+    {15UL, 3164907304UL, 5785627L},
+    {12UL, 540016582UL, 1088426849L}
+};
+
+CONST VSOP87FixedCoefficient L3MercuryFixedCoefficients[] =
+{
+    {188UL, 23924785UL, 272106692L},
+    {142UL, 2136141486UL, 136053346L},
+    {97UL, 2050695827UL, 408160058L},
+    {44UL, 4115062946UL, 544213384L},
+    {35UL, 0UL, 0L},
+    {18UL, 1900311447UL, 680266791L},
+    {7UL, 3978350021UL, 816320116L},
+    {3UL, 1756762713UL, 952373401L}
+};
+
+CONST VSOP87FixedCoefficient L4MercuryFixedCoefficients[] =
+{
+    {114UL, 2147488597UL, 0L},
+    {3UL, 1387637490UL, 136053336L},
+    {2UL, 970662662UL, 408160058L},
+    {2UL, 3076043740UL, 272106712L},
+    {1UL, 3076043740UL, 544213384L},
+    {1UL, 868127887UL, 680266791L}
+};
+
+CONST VSOP87FixedCoefficient L5MercuryFixedCoefficients[] =
+{
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0MercuryFixedCoefficients[] =
+{
+    {11737530UL, 1355902982UL, 136053346L},
+    {2388077UL, 3443385042UL, 272106692L},
+    {1222840UL, 2147483871UL, 0L},
+    {543252UL, 1227986778UL, 408160058L},
+    {129779UL, 3303209558UL, 544213384L},
+    {31867UL, 1080634704UL, 680266750L},
+    {7963UL, 3151030990UL, 816320116L},
+    {2014UL, 925000503UL, 952373482L},
+    {514UL, 2992648628UL, 1088426767L},
+    {209UL, 1380801844UL, 130267735L},
+    {208UL, 3361774177UL, 141838967L},
+    {132UL, 764909515UL, 1224480134L},
+    {121UL, 1239303820UL, 277892313L},
+    {100UL, 3866928808UL, 106528428L}
+};
+
+CONST VSOP87FixedCoefficient B1MercuryFixedCoefficients[] =
+{
+    {429151UL, 2393639170UL, 136053346L},
+    {146234UL, 2147483871UL, 0L},
+    {22675UL, 10356014UL, 272106692L},
+    {10895UL, 331802579UL, 408160058L},
+    {6353UL, 2344218734UL, 544213384L},
+    {2496UL, 109712230UL, 680266750L},
+    {860UL, 2177155364UL, 816320116L},
+    {278UL, 4244940387UL, 952373482L},
+    {86UL, 2016517596UL, 1088426849L},
+    {28UL, 198233924UL, 141838957L},
+    {26UL, 4087720361UL, 1224480134L}
+};
+
+CONST VSOP87FixedCoefficient B2MercuryFixedCoefficients[] =
+{
+    {11831UL, 3274728758UL, 136053346L},
+    {1914UL, 0UL, 0L},
+    {1045UL, 828617858UL, 272106692L},
+    {266UL, 3030928442UL, 408160058L},
+    {170UL, 1109426460UL, 544213384L},
+    {96UL, 3281113453UL, 680266791L},
+    {45UL, 1100540103UL, 816320116L},
+    {18UL, 3192249889UL, 952373401L},
+    {7UL, 977498308UL, 1088426849L}
+};
+
+CONST VSOP87FixedCoefficient B3MercuryFixedCoefficients[] =
+{
+    {235UL, 241982109UL, 136053346L},
+    {161UL, 0UL, 0L},
+    {19UL, 2980344693UL, 272106712L},
+    {6UL, 1715748835UL, 408160058L},
+    {5UL, 4197090701UL, 544213384L},
+    {3UL, 2132723582UL, 680266791L},
+    {2UL, 4285954265UL, 816320116L}
+};
+
+CONST VSOP87FixedCoefficient B4MercuryFixedCoefficients[] =
+{
+    {4UL, 1196239232UL, 136053336L},
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient R0MercuryFixedCoefficients[] =
+{
+    {39528272UL, 0UL, 0L},
+    {7834132UL, 4232866573UL, 136053346L},
+    {795526UL, 2023282837UL, 272106692L},
+    {121282UL, 4108666190UL, 408160058L},
+    {21922UL, 1899080988UL, 544213384L},
+    {4354UL, 3984433539UL, 680266750L},
+    {918UL, 1775218941UL, 816320116L},
+    {290UL, 973396969UL, 130528474L},
+    {260UL, 2069835734UL, 141838967L},
+    {202UL, 3860092999UL, 952373482L},
+    {201UL, 3822497026UL, 165578263L},
+    {142UL, 4274333520UL, 130267735L},
+    {100UL, 2552432717UL, 112314049L}
+};
+
+CONST VSOP87FixedCoefficient R1MercuryFixedCoefficients[] =
+{
+    {217348UL, 3182797359UL, 136053346L},
+    {44142UL, 973301222UL, 272106692L},
+    {10094UL, 3058722141UL, 408160058L},
+    {2433UL, 849193165UL, 544213384L},
+    {1624UL, 0UL, 0L},
+    {604UL, 2934545879UL, 680266750L},
+    {153UL, 725262750UL, 816320116L},
+    {39UL, 2809453374UL, 952373401L}
+};
+
+CONST VSOP87FixedCoefficient R2MercuryFixedCoefficients[] =
+{
+    {3118UL, 2106953213UL, 136053346L},
+    {1245UL, 4205156969UL, 272106692L},
+    {425UL, 2000112077UL, 408160058L},
+    {136UL, 4087720361UL, 544213384L},
+    {42UL, 1879804508UL, 680266791L},
+    {22UL, 2146395037UL, 0L},
+    {13UL, 3964678729UL, 816320116L}
+};
+
+CONST VSOP87FixedCoefficient R3MercuryFixedCoefficients[] =
+{
+    {33UL, 1148389627UL, 136053336L},
+    {24UL, 3164907304UL, 272106712L},
+    {12UL, 950155723UL, 408160058L},
+    {5UL, 3035029863UL, 544213384L},
+    {2UL, 827114010UL, 680266791L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Venus.
+//
+
+CONST VSOP87FixedCoefficient L0VenusFixedCoefficients[] =
+{
+    {317614634UL, 0UL, 0L},
+    {1353968UL, 3823271482UL, 53264214L},
+    {89892UL, 3627339106UL, 106528428L},
+    {5477UL, 3018829203UL, 40993574L},
+    {3456UL, 1845352805UL, 61490360L},
+    {2372UL, 2046457671UL, 20496787L},
+    {1664UL, 2905288994UL, 8226145L},
+    {1438UL, 2841922490UL, 50501778L},
+    {1317UL, 3545447924UL, 137151L},
+    {1201UL, 4206387427UL, 159792653L},
+    {769UL, 557789254UL, 49219718L},
+    {761UL, 1332952320UL, 2762439L},
+    {708UL, 727997058UL, 4044499L},
+    {585UL, 2732893908UL, 998438L},
+    {500UL, 2818339730UL, 81987149L},
+    {429UL, 2451265055UL, 101003557L},
+    {327UL, 3880600101UL, 28722932L},
+    {326UL, 3138248235UL, 54262658L},
+    {232UL, 2162117040UL, 47739343L},
+    {180UL, 3180629144UL, 5785621L},
+    {155UL, 3807458702UL, 102483937L},
+    {128UL, 2888746740UL, 108346L},
+    {128UL, 657589804UL, 29524918L},
+    {106UL, 1050639788UL, 4181648L}
+};
+
+CONST VSOP87FixedCoefficient L1VenusFixedCoefficients[] =
+{
+    {3989659808UL, 0UL, 0L},
+    {374UL, 1684468945UL, 53264214L},
+    {56UL, 352890583UL, 106528428L},
+    {1UL, 1226999640UL, 159792653L},
+    {1UL, 1814865787UL, 137149L},
+    {1UL, 4173849536UL, 8226147L},
+    {0UL, 3896321940UL, 998448L},
+    {0UL, 1831954984UL, 49219703L},
+    {0UL, 2460834927UL, 4044484L},
+    {0UL, 704072214UL, 2762434L},
+    {0UL, 854456594UL, 28722914L},
+    {0UL, 4176583925UL, 54262638L}
+};
+
+CONST VSOP87FixedCoefficient L2VenusFixedCoefficients[] =
+{
+    {54127UL, 0UL, 0L},
+    {3891UL, 235898367UL, 53264214L},
+    {1338UL, 1380870293UL, 106528428L},
+    {24UL, 1401308782UL, 137159L},
+    {19UL, 2419821049UL, 159792663L},
+    {10UL, 2713754164UL, 4044484L},
+    {7UL, 1039019206UL, 8226126L},
+    {6UL, 683565276UL, 998448L}
+};
+
+CONST VSOP87FixedCoefficient L3VenusFixedCoefficients[] =
+{
+    {136UL, 3283847516UL, 53264219L},
+    {78UL, 2508684614UL, 106528428L},
+    {26UL, 0UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient L4VenusFixedCoefficients[] =
+{
+    {114UL, 2147488597UL, 0L},
+    {3UL, 3561375112UL, 106528428L},
+    {2UL, 1715748835UL, 53264240L}
+};
+
+CONST VSOP87FixedCoefficient L5VenusFixedCoefficients[] =
+{
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0VenusFixedCoefficients[] =
+{
+    {5923638UL, 182531071UL, 53264214L},
+    {40108UL, 784302277UL, 106528428L},
+    {32815UL, 2147481915UL, 0L},
+    {1011UL, 744744334UL, 159792653L},
+    {149UL, 4275017361UL, 94257791L},
+    {138UL, 587866147UL, 8226147L},
+    {130UL, 2510051645UL, 49219718L},
+    {120UL, 2532609294UL, 12270641L},
+    {108UL, 3102702809UL, 114754574L}
+};
+
+CONST VSOP87FixedCoefficient B1VenusFixedCoefficients[] =
+{
+    {513348UL, 1232907716UL, 53264214L},
+    {4380UL, 2314688703UL, 106528428L},
+    {199UL, 0UL, 0L},
+    {197UL, 1729420128UL, 159792653L}
+};
+
+CONST VSOP87FixedCoefficient B2VenusFixedCoefficients[] =
+{
+    {22378UL, 2313930056UL, 53264214L},
+    {282UL, 0UL, 0L},
+    {173UL, 3592819117UL, 106528428L},
+    {27UL, 2645397538UL, 159792663L}
+};
+
+CONST VSOP87FixedCoefficient B3VenusFixedCoefficients[] =
+{
+    {647UL, 3412357926UL, 53264219L},
+    {20UL, 2146395037UL, 0L},
+    {6UL, 526345249UL, 106528428L},
+    {3UL, 3718595138UL, 159792663L}
+};
+
+CONST VSOP87FixedCoefficient B4VenusFixedCoefficients[] =
+{
+    {14UL, 218740883UL, 53264240L}
+};
+
+CONST VSOP87FixedCoefficient R0VenusFixedCoefficients[] =
+{
+    {72334826UL, 0UL, 0L},
+    {489824UL, 2748970217UL, 53264214L},
+    {1658UL, 3350905396UL, 106528428L},
+    {1632UL, 1945084986UL, 40993574L},
+    {1378UL, 771403403UL, 61490360L},
+    {498UL, 1768383295UL, 50501778L},
+    {374UL, 972713372UL, 20496788L},
+    {264UL, 3779432276UL, 49219718L},
+    {237UL, 1743775099UL, 81987149L},
+    {222UL, 1376016908UL, 101003557L},
+    {126UL, 1864766021UL, 8226147L},
+    {119UL, 2064367119UL, 54262658L}
+};
+
+CONST VSOP87FixedCoefficient R1VenusFixedCoefficients[] =
+{
+    {34551UL, 609733394UL, 53264214L},
+    {234UL, 1211277638UL, 106528428L},
+    {234UL, 2147762068UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient R2VenusFixedCoefficients[] =
+{
+    {1407UL, 3461369622UL, 53264214L},
+    {16UL, 3739101914UL, 106528428L},
+    {13UL, 0UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient R3VenusFixedCoefficients[] =
+{
+    {50UL, 2201080207UL, 53264240L}
+};
+
+CONST VSOP87FixedCoefficient R4VenusFixedCoefficients[] =
+{
+    {1UL, 628880065UL, 53264240L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Earth.
+//
+
+CONST VSOP87FixedCoefficient L0EarthFixedCoefficients[] =
+{
+    {175347047UL, 0UL, 0L},
+    {3341656UL, 3191742060UL, 32767428L},
+    {34894UL, 3162241365UL, 65534857L},
+    {3497UL, 1875771537UL, 30004990L},
+    {3418UL, 1933737876UL, 18374L},
+    {3136UL, 2479769812UL, 405292030L},
+    {2676UL, 3020059662UL, 40993574L},
+    {2343UL, 4193809695UL, 20496787L},
+    {1324UL, 507547222UL, 60009980L},
+    {1273UL, 1392490875UL, 2762439L},
+    {1199UL, 758483994UL, 8226145L},
+    {990UL, 3577096951UL, 30691006L},
+    {902UL, 1397891041UL, 137149L},
+    {857UL, 2397946916UL, 2076422L},
+    {780UL, 805923474UL, 27242552L},
+    {753UL, 1731470838UL, 28722932L},
+    {505UL, 3132779783UL, 98302293L},
+    {492UL, 2874391932UL, 4044499L},
+    {357UL, 1996010657UL, 349L},
+    {317UL, 3998173281UL, 61490360L},
+    {284UL, 1298090492UL, 4152845L},
+    {271UL, 215323060UL, 57247544L},
+    {243UL, 235830019UL, 28614584L},
+    {206UL, 3285214873UL, 13269079L},
+    {205UL, 1277583471UL, 29064995L},
+    {202UL, 1680203410UL, 31655035L},
+    {156UL, 569409877UL, 1112395L},
+    {132UL, 2331641164UL, 15345501L},
+    {126UL, 740301156UL, 108346L},
+    {115UL, 440899590UL, 5111L},
+    {103UL, 434747500UL, 24480113L},
+    {102UL, 667159716UL, 81987149L},
+    {102UL, 2916773166UL, 37101L},
+    {99UL, 4244940387UL, 11192682L},
+    {98UL, 464824392UL, 810545L},
+    {86UL, 4087720361UL, 839649043L},
+    {85UL, 888634826UL, 32730318L},
+    {85UL, 2508684614UL, 372524630L},
+    {80UL, 1237253110UL, 90014949L},
+    {79UL, 2078038412UL, 62772416L},
+    {75UL, 1203074878UL, 26538167L},
+    {74UL, 2392478465UL, 16452305L},
+    {74UL, 3199085372UL, 4181643L},
+    {70UL, 567359167UL, 49219703L},
+    {62UL, 2720589810UL, 46036507L},
+    {61UL, 1244088837UL, 36949093L},
+    {57UL, 1900311447UL, 32785809L},
+    {56UL, 3000851469UL, 73761028L},
+    {56UL, 2371971526UL, 32749040L},
+    {52UL, 129877401UL, 63310049L},
+    {52UL, 909141846UL, 9116255L},
+    {51UL, 191398278UL, 30542651L},
+    {49UL, 334946992UL, 6229282L},
+    {41UL, 3670745452UL, 43960082L},
+    {41UL, 1640556727UL, 102483947L},
+    {39UL, 4217597802UL, 54485113L},
+    {37UL, 4128734238UL, 53264240L},
+    {37UL, 1756762713UL, 5524867L},
+    {36UL, 1168896647UL, 12270663L},
+    {36UL, 1216746171UL, 35529884L},
+    {33UL, 403303495UL, 92777431L},
+    {30UL, 300768720UL, 438059471L},
+    {30UL, 1872968862UL, 7039827L},
+    {25UL, 2160066329UL, 24461740L}
+};
+
+CONST VSOP87FixedCoefficient L1EarthFixedCoefficients[] =
+{
+    {2454421762UL, 0UL, 0L},
+    {805UL, 1830748483UL, 32767428L},
+    {17UL, 1801262781UL, 65534857L},
+    {2UL, 1086868811UL, 18373L},
+    {0UL, 3961944340UL, 137149L},
+    {0UL, 2027454662UL, 8226147L},
+    {0UL, 1770434005UL, 98302303L},
+    {0UL, 779264404UL, 2762434L},
+    {0UL, 1278267069UL, 2076428L},
+    {0UL, 3014522761UL, 28722914L},
+    {0UL, 1975503718UL, 27242531L},
+    {0UL, 1483336700UL, 810545L},
+    {0UL, 273426114UL, 4152855L},
+    {0UL, 321275679UL, 4044484L},
+    {0UL, 1811448045UL, 37080L},
+    {0UL, 3650238676UL, 5111L},
+    {0UL, 1264595776UL, 28614595L},
+    {0UL, 3397319276UL, 1112400L},
+    {0UL, 2043860180UL, 32730318L},
+    {0UL, 20506958UL, 13269058L},
+    {0UL, 977498308UL, 11192682L},
+    {0UL, 827114010UL, 57247549L},
+    {0UL, 1934489678UL, 9116255L},
+    {0UL, 2228422792UL, 26538167L},
+    {0UL, 3602388989UL, 6229282L},
+    {0UL, 1421815721UL, 24480098L},
+    {0UL, 526345249UL, 2886972L},
+    {0UL, 888634826UL, 32785809L},
+    {0UL, 2898316612UL, 7039827L},
+    {0UL, 1845626277UL, 1265883L},
+    {0UL, 3855308063UL, 4963400L},
+    {0UL, 3622896091UL, 12270663L},
+    {0UL, 1811448045UL, 49219703L},
+    {0UL, 3192249889UL, 24461740L}
+};
+
+CONST VSOP87FixedCoefficient L2EarthFixedCoefficients[] =
+{
+    {52919UL, 0UL, 0L},
+    {8720UL, 732850362UL, 32767428L},
+    {309UL, 592651083UL, 65534862L},
+    {27UL, 34178264UL, 18357L},
+    {16UL, 3547703819UL, 137159L},
+    {16UL, 2515520260UL, 810545L},
+    {10UL, 519509603UL, 98302303L},
+    {9UL, 1408144429UL, 405292030L},
+    {7UL, 567359167UL, 4044484L},
+    {5UL, 3185414080UL, 8226126L},
+    {4UL, 704072214UL, 37080L},
+    {4UL, 2351464587UL, 29064980L},
+    {3UL, 3513525425UL, 4152855L},
+    {3UL, 4135570048UL, 28722914L},
+    {3UL, 813442717UL, 1265883L},
+    {3UL, 4183419408UL, 2762434L},
+    {3UL, 211905237UL, 2076428L},
+    {3UL, 1558528809UL, 2886972L},
+    {2UL, 2994015985UL, 27242531L},
+    {2UL, 2563369783UL, 5111L}
+};
+
+CONST VSOP87FixedCoefficient L3EarthFixedCoefficients[] =
+{
+    {289UL, 3994755377UL, 32767431L},
+    {35UL, 0UL, 0L},
+    {17UL, 3752773206UL, 65534851L},
+    {3UL, 3554539303UL, 810545L},
+    {1UL, 3226427957UL, 18357L},
+    {1UL, 3622896091UL, 98302303L},
+    {1UL, 4080884552UL, 1265883L}
+};
+
+CONST VSOP87FixedCoefficient L4EarthFixedCoefficients[] =
+{
+    {114UL, 2147762068UL, 0L},
+    {8UL, 2823124666UL, 32767451L},
+    {1UL, 2624890600UL, 65534851L}
+};
+
+CONST VSOP87FixedCoefficient L5EarthFixedCoefficients[] =
+{
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0EarthFixedCoefficients[] =
+{
+    {280UL, 2186725236UL, 439821227L},
+    {102UL, 3706290877UL, 28722932L},
+    {80UL, 2652233347UL, 27242531L},
+    {44UL, 2529191552UL, 12270663L},
+    {32UL, 2734261102UL, 8226126L}
+};
+
+CONST VSOP87FixedCoefficient B1EarthFixedCoefficients[] =
+{
+    {9UL, 2665904640UL, 28722914L},
+    {6UL, 1182567940UL, 27242531L}
+};
+
+CONST VSOP87FixedCoefficient R0EarthFixedCoefficients[] =
+{
+    {100013985UL, 0UL, 0L},
+    {1670700UL, 2118002406UL, 32767428L},
+    {13956UL, 2088462760UL, 65534857L},
+    {3084UL, 3553514192UL, 405292030L},
+    {1628UL, 802437283UL, 30004990L},
+    {1576UL, 1946041974UL, 40993574L},
+    {925UL, 3727481495UL, 60009980L},
+    {542UL, 3119792006UL, 20496788L},
+    {472UL, 2502532483UL, 30691006L},
+    {346UL, 658956917UL, 28722932L},
+    {329UL, 4033035191UL, 27242552L},
+    {307UL, 204386014UL, 29064995L},
+    {243UL, 2920874261UL, 61490360L},
+    {212UL, 3996806250UL, 8226147L},
+    {186UL, 3432864702UL, 57247544L},
+    {175UL, 2058898667UL, 98302293L},
+    {110UL, 3455422351UL, 28614584L},
+    {98UL, 608373085UL, 31655050L},
+    {86UL, 3889486457UL, 81987154L},
+    {86UL, 868127887UL, 839649043L},
+    {65UL, 184562632UL, 90014949L},
+    {63UL, 628880065UL, 2762434L},
+    {57UL, 1373966197UL, 438059471L},
+    {56UL, 3581881888UL, 372524630L},
+    {49UL, 2221587146UL, 13269058L},
+    {47UL, 1763598359UL, 4044484L},
+    {45UL, 3786951601UL, 49219703L},
+    {43UL, 4108227463UL, 32730318L},
+    {39UL, 3663909968UL, 24480098L},
+    {38UL, 1633721080UL, 46036507L},
+    {37UL, 567359167UL, 102483947L},
+    {37UL, 3349469916UL, 63310049L},
+    {36UL, 1141553981UL, 62772416L},
+    {35UL, 1257760130UL, 15345485L},
+    {33UL, 164055662UL, 36949093L},
+    {32UL, 123041754UL, 26538167L},
+    {32UL, 1216746171UL, 2076428L},
+    {28UL, 827114010UL, 32785809L},
+    {28UL, 1298774007UL, 32749040L},
+    {26UL, 3137564719UL, 54485113L}
+};
+
+CONST VSOP87FixedCoefficient R1EarthFixedCoefficients[] =
+{
+    {103019UL, 757041668UL, 32767428L},
+    {1721UL, 727586850UL, 65534857L},
+    {702UL, 2147762068UL, 0L},
+    {32UL, 697236568UL, 98302303L},
+    {31UL, 1941325324UL, 28722914L},
+    {25UL, 902306200UL, 27242531L},
+    {18UL, 970662662UL, 8226126L},
+    {10UL, 4039870674UL, 57247549L},
+    {9UL, 970662662UL, 32730318L},
+    {9UL, 184562632UL, 28614595L}
+};
+
+CONST VSOP87FixedCoefficient R2EarthFixedCoefficients[] =
+{
+    {4359UL, 3954151543UL, 32767428L},
+    {124UL, 3813610670UL, 65534862L},
+    {12UL, 2146395037UL, 0L},
+    {9UL, 2481342029UL, 405292030L},
+    {6UL, 1278267069UL, 29064980L},
+    {3UL, 3739101914UL, 98302303L}
+};
+
+CONST VSOP87FixedCoefficient R3EarthFixedCoefficients[] =
+{
+    {145UL, 2920874261UL, 32767431L},
+    {7UL, 2679575932UL, 65534851L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Mars.
+//
+
+CONST VSOP87FixedCoefficient L0MarsFixedCoefficients[] =
+{
+    {620347752UL, 0UL, 0L},
+    {18656368UL, 3452258361UL, 17421925L},
+    {1108217UL, 3691935417UL, 34843850L},
+    {91798UL, 3933774496UL, 52265775L},
+    {27745UL, 4081226473UL, 18374L},
+    {12316UL, 580729731UL, 14659487L},
+    {10610UL, 2009401633UL, 11897048L},
+    {8927UL, 2841580895UL, 90L},
+    {8716UL, 4176652048UL, 69687701L},
+    {7775UL, 2282902940UL, 29318974L},
+    {6798UL, 249227901UL, 2076422L},
+    {4161UL, 155921241UL, 15345503L},
+    {3575UL, 1136017161UL, 13269081L},
+    {3075UL, 585815437UL, 998439L},
+    {2938UL, 4155324858UL, 351L},
+    {2628UL, 443018668UL, 17403552L},
+    {2580UL, 20506958UL, 17440299L},
+    {2389UL, 3444485447UL, 4152845L},
+    {1799UL, 448623896UL, 2762439L},
+    {1546UL, 1993139695UL, 9134610L},
+    {1528UL, 785963315UL, 32081412L},
+    {1286UL, 2097178319UL, 11192658L},
+    {1264UL, 2476420357UL, 26556535L},
+    {1025UL, 2524611638UL, 46740899L},
+    {892UL, 125092444UL, 87109631L},
+    {859UL, 1641240242UL, 15197134L},
+    {833UL, 3072625835UL, 17422017L},
+    {833UL, 1684304830UL, 17421835L},
+    {749UL, 2612586502UL, 810545L},
+    {724UL, 461406569UL, 19498346L},
+    {713UL, 2503899677UL, 5524877L},
+    {655UL, 334263415UL, 16309529L},
+    {636UL, 1997377688UL, 43978458L},
+    {553UL, 3058954543UL, 9116234L},
+    {550UL, 2604383661UL, 5111L},
+    {472UL, 2477924124UL, 6229267L},
+    {426UL, 378695176UL, 32767431L},
+    {415UL, 339731948UL, 1112395L},
+    {312UL, 682881719UL, 34825480L},
+    {307UL, 260438378UL, 34862226L},
+    {302UL, 3066473868UL, 18420366L},
+    {299UL, 1902362157UL, 32619063L},
+    {293UL, 2885329161UL, 108346L},
+    {284UL, 3943488111UL, 16423486L},
+    {281UL, 4020730930UL, 7039811L},
+    {274UL, 370492376UL, 17421574L},
+    {274UL, 91597749UL, 17422278L},
+    {239UL, 3672112809UL, 21574769L},
+    {236UL, 3933918239UL, 17384828L},
+    {231UL, 876330646UL, 20184362L},
+    {221UL, 2395896369UL, 1996880L},
+    {204UL, 1928337710UL, 6372174L},
+    {193UL, 2294728707UL, 18723L},
+    {189UL, 1019195864UL, 49503340L},
+    {179UL, 687666696UL, 4963390L},
+    {174UL, 1650126599UL, 2886967L},
+    {172UL, 300085163UL, 28614584L},
+    {160UL, 2699399192UL, 23794097L},
+    {144UL, 969979146UL, 704390L},
+    {140UL, 2273538090UL, 14084740L},
+    {138UL, 2940014331UL, 37101L},
+    {131UL, 2765021592UL, 64162829L},
+    {128UL, 1509312091UL, 8305689L},
+    {128UL, 1235202481UL, 26538162L},
+    {117UL, 2138192196UL, 41216022L},
+    {113UL, 2529875068UL, 8287316L},
+    {110UL, 719110701UL, 1265878L},
+    {105UL, 536598759UL, 46036507L},
+    {100UL, 2216802210UL, 61400388L}
+};
+
+CONST VSOP87FixedCoefficient L1MarsFixedCoefficients[] =
+{
+    {2610044232UL, 0UL, 0L},
+    {11392UL, 2463746958UL, 17421925L},
+    {1288UL, 2683891176UL, 34843850L},
+    {156UL, 2916048581UL, 52265775L},
+    {27UL, 3234699247UL, 18374L},
+    {19UL, 3153149986UL, 69687701L},
+    {7UL, 3048017639UL, 11897046L},
+    {4UL, 3428763281UL, 2076422L},
+    {4UL, 3413724958UL, 17440302L},
+    {3UL, 1750610745UL, 998438L},
+    {3UL, 3633832995UL, 810545L},
+    {3UL, 2419137534UL, 4152845L},
+    {2UL, 3392534340UL, 87109631L},
+    {2UL, 2160066329UL, 13269079L},
+    {2UL, 3123209585UL, 11192657L},
+    {1UL, 908458249UL, 17403551L},
+    {1UL, 2860720639UL, 9134613L},
+    {1UL, 1526401288UL, 5111L},
+    {1UL, 4083618941UL, 9116234L},
+    {1UL, 4117797335UL, 32081414L},
+    {1UL, 1512729995UL, 5524877L},
+    {1UL, 1455310436UL, 6229267L},
+    {1UL, 3710392298UL, 19498346L},
+    {1UL, 751921819UL, 7039827L},
+    {1UL, 2672740286UL, 2886972L},
+    {1UL, 3622896091UL, 34862236L},
+    {1UL, 3028194053UL, 2762434L},
+    {1UL, 1538021870UL, 46740924L},
+    {1UL, 1708913189UL, 4963400L},
+    {1UL, 3992021314UL, 1265883L},
+    {1UL, 2638561892UL, 15197113L},
+    {1UL, 3431497670UL, 1996896L},
+    {1UL, 697236568UL, 17421861L},
+    {1UL, 2084874058UL, 17422017L},
+    {0UL, 2836795959UL, 16423465L},
+    {0UL, 2659068994UL, 21574769L},
+    {0UL, 3328962814UL, 1112400L},
+    {0UL, 806606989UL, 17384833L},
+    {0UL, 895470472UL, 16611368L},
+    {0UL, 485331331UL, 8305710L},
+    {0UL, 1866133215UL, 37080L},
+    {0UL, 3636567383UL, 104531530L},
+    {0UL, 3698088037UL, 32767451L},
+    {0UL, 34178264UL, 49503360L},
+    {0UL, 2659068994UL, 6372179L},
+    {0UL, 3493018649UL, 14084766L}
+};
+
+CONST VSOP87FixedCoefficient L2MarsFixedCoefficients[] =
+{
+    {58016UL, 1401165202UL, 17421926L},
+    {54188UL, 0UL, 0L},
+    {13908UL, 1679807055UL, 34843850L},
+    {2465UL, 1913982739UL, 52265775L},
+    {398UL, 2147078553UL, 69687706L},
+    {222UL, 2183307494UL, 18373L},
+    {121UL, 371175933UL, 810545L},
+    {62UL, 2385642818UL, 87109621L},
+    {54UL, 2419821049UL, 17440322L},
+    {34UL, 4101391653UL, 11897046L},
+    {32UL, 2829960150UL, 998448L},
+    {30UL, 1367130551UL, 4152855L},
+    {23UL, 2959837591UL, 1265883L},
+    {22UL, 2358300233UL, 2076428L},
+    {20UL, 3704923846UL, 2886972L},
+    {16UL, 451153100UL, 5111L},
+    {16UL, 4176583925UL, 11192682L},
+    {16UL, 833949656UL, 9116255L},
+    {15UL, 4169748116UL, 16611368L},
+    {14UL, 2747932395UL, 4963400L},
+    {14UL, 1790940944UL, 7039827L},
+    {13UL, 410139182UL, 6229282L},
+    {12UL, 2638561892UL, 34862236L},
+    {11UL, 3226427957UL, 13269058L},
+    {10UL, 170891319UL, 1996896L},
+    {9UL, 464824392UL, 5524867L},
+    {9UL, 2618054953UL, 104531530L},
+    {9UL, 2652233347UL, 19498341L},
+    {8UL, 3732266431UL, 9134613L},
+    {7UL, 1763598359UL, 16423465L},
+    {7UL, 1626885434UL, 21574769L},
+    {6UL, 3745937723UL, 8305710L},
+    {6UL, 1599542686UL, 16156030L}
+};
+
+CONST VSOP87FixedCoefficient L3MarsFixedCoefficients[] =
+{
+    {1482UL, 303708049UL, 17421925L},
+    {662UL, 604955262UL, 34843853L},
+    {188UL, 880432066UL, 52265775L},
+    {41UL, 1127882688UL, 69687706L},
+    {26UL, 0UL, 0L},
+    {23UL, 1401308782UL, 810545L},
+    {10UL, 1080033165UL, 18357L},
+    {8UL, 1367130551UL, 87109621L},
+    {5UL, 1927654031UL, 1265883L},
+    {4UL, 1380801844UL, 17440322L},
+    {3UL, 3137564719UL, 16611368L},
+    {3UL, 444317413UL, 2886972L}
+};
+
+CONST VSOP87FixedCoefficient L4MarsFixedCoefficients[] =
+{
+    {114UL, 2147488597UL, 0L},
+    {29UL, 3855308063UL, 34843827L},
+    {24UL, 3513525425UL, 17421914L},
+    {11UL, 4121898755UL, 52265791L},
+    {3UL, 88863483UL, 69687706L},
+    {3UL, 2433492342UL, 810545L},
+    {1UL, 334946992UL, 87109621L},
+    {1UL, 902306200UL, 1265883L}
+};
+
+CONST VSOP87FixedCoefficient L5MarsFixedCoefficients[] =
+{
+    {1UL, 2146395037UL, 0L},
+    {1UL, 2761603687UL, 34843827L}
+};
+
+CONST VSOP87FixedCoefficient B0MarsFixedCoefficients[] =
+{
+    {3197135UL, 2575892756UL, 17421925L},
+    {298033UL, 2806835349UL, 34843850L},
+    {289105UL, 0UL, 0L},
+    {31366UL, 3039479723UL, 52265775L},
+    {3484UL, 3272978736UL, 69687701L},
+    {443UL, 3435599091UL, 17440302L},
+    {443UL, 3863510904UL, 17403551L},
+    {399UL, 3507373458UL, 87109631L},
+    {293UL, 2592763079UL, 11897046L},
+    {182UL, 4194356638UL, 32081414L},
+    {163UL, 2914722293UL, 2762439L},
+    {160UL, 1525717772UL, 5524877L},
+    {149UL, 1479918796UL, 29318974L},
+    {143UL, 807974184UL, 17421835L},
+    {143UL, 2196295271UL, 17422017L},
+    {139UL, 1652860825UL, 46740899L}
+};
+
+CONST VSOP87FixedCoefficient B1MarsFixedCoefficients[] =
+{
+    {350069UL, 3669705021UL, 17421926L},
+    {14116UL, 2147481915UL, 0L},
+    {9671UL, 3745117309UL, 34843853L},
+    {1472UL, 2188844395UL, 52265775L},
+    {426UL, 2329590454UL, 69687706L},
+    {102UL, 530446669UL, 17403551L},
+    {79UL, 2542862845UL, 87109621L},
+    {33UL, 2365135880UL, 29318958L},
+    {26UL, 1695241896UL, 11897046L}
+};
+
+CONST VSOP87FixedCoefficient B2MarsFixedCoefficients[] =
+{
+    {16727UL, 411649835UL, 17421926L},
+    {4987UL, 2147488597UL, 0L},
+    {302UL, 3799939377UL, 34843853L},
+    {26UL, 1298774007UL, 69687706L},
+    {21UL, 628880065UL, 52265791L},
+    {12UL, 1531186224UL, 17403556L},
+    {8UL, 1538021870UL, 87109621L}
+};
+
+CONST VSOP87FixedCoefficient B3MarsFixedCoefficients[] =
+{
+    {607UL, 1354142774UL, 17421924L},
+    {43UL, 0UL, 0L},
+    {14UL, 1230417463UL, 34843827L},
+    {3UL, 2358300233UL, 52265791L}
+};
+
+CONST VSOP87FixedCoefficient B4MarsFixedCoefficients[] =
+{
+    {13UL, 0UL, 0L},
+    {11UL, 2365135880UL, 17421914L},
+    {1UL, 341782638UL, 34843827L}
+};
+
+CONST VSOP87FixedCoefficient R0MarsFixedCoefficients[] =
+{
+    {153033498UL, 0UL, 0L},
+    {14184954UL, 2378610951UL, 17421925L},
+    {660776UL, 2609738682UL, 34843850L},
+    {46179UL, 2840863154UL, 52265775L},
+    {8110UL, 3800349422UL, 14659487L},
+    {7485UL, 1211551109UL, 29318974L},
+    {5523UL, 932656482UL, 11897048L},
+    {3825UL, 3072010769UL, 69687701L},
+    {2484UL, 3366900707UL, 15345503L},
+    {2307UL, 62067729UL, 13269081L},
+    {1999UL, 3664320013UL, 17403552L},
+    {1960UL, 3241808202UL, 17440299L},
+    {1167UL, 1444100061UL, 26556535L},
+    {1103UL, 3424046795UL, 2076422L},
+    {992UL, 3991337798UL, 32081414L},
+    {899UL, 3013155730UL, 2762439L},
+    {807UL, 1436854208UL, 5524877L},
+    {798UL, 2356933039UL, 4152845L},
+    {741UL, 1024664316UL, 11192657L},
+    {726UL, 851038771UL, 43978458L},
+    {692UL, 1458728341UL, 46740899L},
+    {633UL, 611107352UL, 17421835L},
+    {633UL, 1998744883UL, 17422017L},
+    {630UL, 879748469UL, 9134613L},
+    {574UL, 566675611UL, 15197134L},
+    {526UL, 3679631808UL, 19498346L},
+    {473UL, 3553855787UL, 16309529L},
+    {348UL, 3302987260UL, 87109631L},
+    {284UL, 1987124300UL, 18420366L},
+    {280UL, 3593502633UL, 32767431L},
+    {276UL, 832582543UL, 32619063L},
+    {275UL, 1987807816UL, 9116234L},
+    {270UL, 2572939656UL, 30691006L},
+    {239UL, 1392422426UL, 6229267L},
+    {234UL, 3489600745UL, 28614584L},
+    {228UL, 2225005050UL, 35842289L},
+    {223UL, 2870290511UL, 16423486L},
+    {219UL, 3816345059UL, 998438L},
+    {208UL, 3592135601UL, 17421574L},
+    {208UL, 3312557458UL, 17422278L},
+    {186UL, 3895638425UL, 34825480L},
+    {183UL, 3473195064UL, 34862226L},
+    {179UL, 2860037123UL, 17384828L},
+    {176UL, 4069264132UL, 20184362L},
+    {164UL, 2596864499UL, 21574769L}
+};
+
+CONST VSOP87FixedCoefficient R1MarsFixedCoefficients[] =
+{
+    {1107433UL, 1389349865UL, 17421925L},
+    {103176UL, 1620540505UL, 34843850L},
+    {12877UL, 0UL, 0L},
+    {10816UL, 1851696268UL, 52265775L},
+    {1195UL, 2082823348UL, 69687701L},
+    {439UL, 1974136524UL, 11897046L},
+    {396UL, 2339844005UL, 17440302L},
+    {183UL, 1082767391UL, 13269079L},
+    {136UL, 2313868451UL, 87109631L},
+    {128UL, 4130785112UL, 17403551L},
+    {128UL, 430646120UL, 5524877L},
+    {127UL, 1335686546UL, 4152845L},
+    {118UL, 2049328632UL, 11192657L},
+    {88UL, 2337793295UL, 2076428L},
+    {83UL, 2638561892UL, 19498341L},
+    {76UL, 3041865346UL, 32081392L},
+    {72UL, 1886640154UL, 2762434L},
+    {67UL, 1743091420UL, 9134613L},
+    {66UL, 3014522761UL, 9116255L},
+    {58UL, 369125263UL, 6229282L},
+    {54UL, 464824392UL, 46740924L},
+    {51UL, 2549698491UL, 34862236L},
+    {49UL, 3916829042UL, 17421861L},
+    {49UL, 1011676621UL, 17422017L},
+    {48UL, 1763598359UL, 16423465L},
+    {48UL, 1565364455UL, 15197113L},
+    {39UL, 1585871394UL, 21574769L}
+};
+
+CONST VSOP87FixedCoefficient R2MarsFixedCoefficients[] =
+{
+    {44242UL, 327639676UL, 17421926L},
+    {8138UL, 594701793UL, 34843853L},
+    {1275UL, 837982708UL, 52265775L},
+    {187UL, 1075248147UL, 69687706L},
+    {52UL, 2146395037UL, 0L},
+    {41UL, 1346623612UL, 17440322L},
+    {27UL, 1312445300UL, 87109621L},
+    {18UL, 3028194053UL, 11897046L},
+    {12UL, 3096550842UL, 16611368L},
+    {10UL, 3684416744UL, 5524867L},
+    {10UL, 287097407UL, 4152855L}
+};
+
+CONST VSOP87FixedCoefficient R3MarsFixedCoefficients[] =
+{
+    {1113UL, 3520292785UL, 17421925L},
+    {424UL, 3836851834UL, 34843853L},
+    {100UL, 4099341106UL, 52265775L},
+    {20UL, 54685221UL, 69687706L},
+    {5UL, 2146395037UL, 0L},
+    {3UL, 293933073UL, 87109621L}
+};
+
+CONST VSOP87FixedCoefficient R4MarsFixedCoefficients[] =
+{
+    {20UL, 2447163634UL, 17421914L},
+    {16UL, 2768439496UL, 34843827L},
+    {6UL, 3048701155UL, 52265791L},
+    {2UL, 3308456038UL, 69687706L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Jupiter.
+//
+
+CONST VSOP87FixedCoefficient L0JupiterFixedCoefficients[] =
+{
+    {59954692UL, 0UL, 0L},
+    {9695900UL, 3460151223UL, 2762439L},
+    {573610UL, 987110635UL, 37098L},
+    {306389UL, 3703110264UL, 5524877L},
+    {97178UL, 2831771776UL, 3300087L},
+    {72903UL, 2488471518UL, 2725340L},
+    {64264UL, 2331948697UL, 537648L},
+    {39806UL, 1567941573UL, 2187692L},
+    {38858UL, 869713793UL, 1650043L},
+    {27965UL, 1219856379UL, 2799537L},
+    {13590UL, 3947459478UL, 8287316L},
+    {8769UL, 2481342029UL, 4950130L},
+    {8246UL, 2448735851UL, 1075296L},
+    {7368UL, 3473195064UL, 3837735L},
+    {6263UL, 17089132UL, 1112395L},
+    {6114UL, 3085066669UL, 6062526L},
+    {5305UL, 2861609177UL, 5487779L},
+    {5305UL, 893214740UL, 74197L},
+    {4905UL, 902852980UL, 574747L},
+    {4647UL, 3212483519UL, 20507L},
+    {3045UL, 2950814662UL, 2224790L},
+    {2610UL, 1070941705UL, 4412482L},
+    {2028UL, 727176725UL, 16592L},
+    {1921UL, 664220387UL, 3337185L},
+    {1765UL, 1463855035UL, 5561976L},
+    {1723UL, 2652506656UL, 6600174L},
+    {1633UL, 2448530829UL, 2688242L},
+    {1432UL, 2937143369UL, 3262989L},
+    {973UL, 2801250533UL, 500549L},
+    {884UL, 1665848601UL, 2150593L},
+    {733UL, 4159494728UL, 4375382L},
+    {731UL, 2601649435UL, 8250215L},
+    {709UL, 883849890UL, 3874833L},
+    {692UL, 4192989280UL, 11049755L},
+    {614UL, 2808769858UL, 7712571L},
+    {582UL, 3103386325UL, 1612943L},
+    {495UL, 2567471204UL, 1687140L},
+    {441UL, 2021986047UL, 2372436L},
+    {417UL, 708173635UL, 12767L},
+    {390UL, 3347419042UL, 8824966L},
+    {376UL, 3214807538UL, 7137821L},
+    {341UL, 3906575654UL, 2782945L},
+    {330UL, 3240099250UL, 250L},
+    {262UL, 1283052005UL, 5022L},
+    {261UL, 560523521UL, 1982439L},
+    {257UL, 2545597071UL, 1038198L},
+    {244UL, 3568210595UL, 3800637L},
+    {235UL, 838734592UL, 4744878L},
+    {220UL, 1128566286UL, 2836635L},
+    {207UL, 1268013599UL, 2741933L},
+    {202UL, 1235202481UL, 7174922L},
+    {197UL, 3618111155UL, 6025426L},
+    {175UL, 2549698491UL, 4913032L},
+    {175UL, 2205181627UL, 9900259L},
+    {175UL, 4039870674UL, 4987228L},
+    {158UL, 2983762271UL, 9362610L},
+    {151UL, 2670005897UL, 390002L},
+    {149UL, 2991965112UL, 8787865L},
+    {141UL, 2143660648UL, 2563568L},
+    {138UL, 900939005UL, 6099623L},
+    {131UL, 2849783736UL, 5450681L},
+    {117UL, 1708913189UL, 8324412L},
+    {117UL, 2316602677UL, 2717L},
+    {106UL, 3112956197UL, 2745849L}
+};
+
+CONST VSOP87FixedCoefficient L1JupiterFixedCoefficients[] =
+{
+    {3312092422UL, 0UL, 0L},
+    {30609UL, 2885101323UL, 2762439L},
+    {14307UL, 4119489012UL, 37098L},
+    {1728UL, 3125711572UL, 5524877L},
+    {1295UL, 3731849542UL, 2725340L},
+    {757UL, 116110401UL, 2799537L},
+    {379UL, 3024229532UL, 537648L},
+    {340UL, 2723870979UL, 2187691L},
+    {265UL, 4026267831UL, 74197L},
+    {138UL, 3600816936UL, 1075296L},
+    {109UL, 3367721122UL, 8287316L},
+    {81UL, 3794675948UL, 16592L},
+    {73UL, 4003300138UL, 5487779L},
+    {73UL, 351694349UL, 20507L},
+    {69UL, 3627681027UL, 2688242L},
+    {63UL, 317721140UL, 3837735L},
+    {63UL, 2153503992UL, 2224790L},
+    {53UL, 3935968786UL, 574745L},
+    {52UL, 3283164000UL, 1112395L},
+    {51UL, 400569269UL, 5561973L},
+    {45UL, 3771913277UL, 3337184L},
+    {35UL, 4093872329UL, 3262987L},
+    {30UL, 2824491698UL, 2150593L},
+    {26UL, 3921613978UL, 500549L},
+    {22UL, 2899683969UL, 3300088L},
+    {21UL, 2551065685UL, 6062527L},
+    {15UL, 2758185783UL, 4950133L},
+    {15UL, 4267498036UL, 1612943L},
+    {12UL, 1028765736UL, 4375382L},
+    {12UL, 1516831416UL, 1687140L},
+    {12UL, 4160178244UL, 3874833L},
+    {12UL, 4292790074UL, 2836635L},
+    {11UL, 3702872973UL, 1038198L},
+    {8UL, 427911854UL, 3800637L},
+    {7UL, 464824392UL, 4412483L},
+    {7UL, 3613325893UL, 11049755L},
+    {7UL, 3071258804UL, 4987228L},
+    {5UL, 3978350021UL, 5450655L},
+    {4UL, 3650238676UL, 4913021L},
+    {4UL, 4080884552UL, 2779018L},
+    {4UL, 3916829042UL, 111292L},
+    {4UL, 88863483UL, 2745849L},
+    {4UL, 4162912633UL, 8250220L},
+    {4UL, 403303495UL, 6025421L},
+    {4UL, 676729629UL, 8324433L},
+    {4UL, 4080884552UL, 6099633L},
+    {4UL, 963827016UL, 2782929L},
+    {3UL, 3711759329UL, 53664L},
+    {3UL, 3916829042UL, 611846L},
+    {3UL, 157220016UL, 7137821L},
+    {3UL, 4156076823UL, 2741938L},
+    {3UL, 2481342029UL, 7712587L},
+    {3UL, 348618284UL, 6600187L},
+    {2UL, 2843631442UL, 8824987L},
+    {2UL, 68356529UL, 1575822L},
+    {2UL, 3445168963UL, 1149480L},
+    {2UL, 3670745452UL, 2651141L},
+    {2UL, 3704923846UL, 6637267L},
+    {2UL, 2296779254UL, 24355L},
+    {2UL, 519509603UL, 463474L},
+    {2UL, 1100540103UL, 4338307L}
+};
+
+CONST VSOP87FixedCoefficient L2JupiterFixedCoefficients[] =
+{
+    {47234UL, 2954013529UL, 37099L},
+    {38966UL, 0UL, 0L},
+    {30629UL, 2002989884UL, 2762439L},
+    {3189UL, 721161330UL, 2725340L},
+    {2729UL, 3312215538UL, 2799537L},
+    {2723UL, 2333760161UL, 5524877L},
+    {1721UL, 2862293019UL, 74197L},
+    {383UL, 3942804596UL, 2187694L},
+    {378UL, 519509603UL, 2688242L},
+    {367UL, 4138987626UL, 537650L},
+    {337UL, 2587978142UL, 16590L},
+    {308UL, 474394305UL, 1075299L},
+    {218UL, 2607117887UL, 8287316L},
+    {199UL, 3650238676UL, 5561973L},
+    {197UL, 1697976122UL, 20506L},
+    {156UL, 961092790UL, 5487776L},
+    {146UL, 2607117887UL, 3337184L},
+    {142UL, 1116945622UL, 2224789L},
+    {130UL, 3989970441UL, 2150593L},
+    {117UL, 966561323UL, 3262987L},
+    {97UL, 2754768204UL, 574766L},
+    {91UL, 758757466UL, 500554L},
+    {87UL, 1722584481UL, 3300068L},
+    {79UL, 3171742787UL, 2836646L},
+    {72UL, 1517514931UL, 3837753L},
+    {58UL, 567359167UL, 1038188L},
+    {57UL, 2132723582UL, 1112400L},
+    {49UL, 1141553981UL, 1612954L},
+    {40UL, 2747932395UL, 111292L},
+    {40UL, 423810474UL, 1687166L},
+    {36UL, 1592707040UL, 3800621L},
+    {29UL, 2467670573UL, 53664L},
+    {28UL, 2214751499UL, 4375387L},
+    {26UL, 3076043740UL, 3874833L},
+    {26UL, 1715748835UL, 6062501L},
+    {25UL, 833949656UL, 5450655L},
+    {24UL, 2057531473UL, 4987233L},
+    {19UL, 2932495006UL, 2779018L},
+    {18UL, 553687875UL, 2651141L},
+    {17UL, 2870974027UL, 11049734L},
+    {17UL, 1250924484UL, 2745849L},
+    {15UL, 3971514212UL, 8324433L},
+    {15UL, 464824392UL, 4913021L},
+    {15UL, 2734261102UL, 611846L},
+    {14UL, 4067213259UL, 1650034L},
+    {14UL, 1230417463UL, 1575822L},
+    {13UL, 1722584481UL, 463474L},
+    {13UL, 2987180176UL, 6099633L},
+    {11UL, 3035029863UL, 2741938L},
+    {10UL, 1175732294UL, 8250220L},
+    {9UL, 1490172346UL, 6025421L},
+    {9UL, 2248929731UL, 1149480L},
+    {9UL, 2269436669UL, 4338307L},
+    {8UL, 3937336144UL, 4412467L},
+    {8UL, 1852461923UL, 2782929L},
+    {7UL, 1490172346UL, 6600187L},
+    {6UL, 341782638UL, 4950153L}
+};
+
+CONST VSOP87FixedCoefficient L3JupiterFixedCoefficients[] =
+{
+    {6502UL, 1776312664UL, 37098L},
+    {1357UL, 920352302UL, 2762439L},
+    {471UL, 1691823992UL, 74196L},
+    {417UL, 2218169241UL, 2799540L},
+    {353UL, 2032923114UL, 2725338L},
+    {155UL, 1419081495UL, 5524877L},
+    {87UL, 1715748835UL, 2688222L},
+    {44UL, 0UL, 0L},
+    {34UL, 2618054953UL, 5561999L},
+    {28UL, 1674734958UL, 1075320L},
+    {24UL, 874963533UL, 2150588L},
+    {23UL, 2037024534UL, 2836646L},
+    {20UL, 1435487014UL, 3337200L},
+    {20UL, 956991370UL, 2187668L},
+    {19UL, 1086868811UL, 537634L},
+    {17UL, 1572200101UL, 111292L},
+    {17UL, 1777269651UL, 8287300L},
+    {16UL, 2153230683UL, 3262987L},
+    {16UL, 2296779254UL, 5487787L},
+    {13UL, 1886640154UL, 500554L},
+    {13UL, 1736255774UL, 1038188L},
+    {13UL, 4285954265UL, 2224800L},
+    {9UL, 1203074878UL, 53664L},
+    {9UL, 1551693163UL, 574766L},
+    {7UL, 2344628941UL, 1612954L},
+    {7UL, 2761603687UL, 3800621L},
+    {6UL, 1722584481UL, 2651141L},
+    {5UL, 1989175011UL, 5450655L},
+    {5UL, 3588717697UL, 1687166L},
+    {4UL, 2939330815UL, 463474L},
+    {4UL, 2406149757UL, 1575822L},
+    {4UL, 2795782081UL, 3837753L},
+    {3UL, 977498308UL, 4987233L},
+    {3UL, 2980344693UL, 8324433L},
+    {3UL, 854456594UL, 1112400L},
+    {3UL, 3431497670UL, 4375387L},
+    {3UL, 1531186224UL, 611846L},
+    {2UL, 1982339364UL, 3874833L},
+    {2UL, 1613213979UL, 4913021L}
+};
+
+CONST VSOP87FixedCoefficient L4JupiterFixedCoefficients[] =
+{
+    {669UL, 583081170UL, 37101L},
+    {114UL, 2147762068UL, 0L},
+    {100UL, 507888980UL, 74196L},
+    {50UL, 1127882688UL, 2799513L},
+    {44UL, 3978350021UL, 2762434L},
+    {32UL, 3322127331UL, 2725354L},
+    {15UL, 2932495006UL, 2688222L},
+    {9UL, 485331331UL, 5524867L},
+    {5UL, 888634826UL, 2836646L},
+    {4UL, 1585871394UL, 5561999L},
+    {4UL, 328111325UL, 111292L},
+    {3UL, 2050695827UL, 2150588L},
+    {2UL, 273426114UL, 3337200L},
+    {2UL, 2911988230UL, 1038188L},
+    {2UL, 3356305399UL, 3262987L},
+    {2UL, 2911988230UL, 1075320L},
+    {1UL, 3595553506UL, 5487787L},
+    {1UL, 3226427957UL, 500554L},
+    {1UL, 881799179UL, 8287300L}
+};
+
+CONST VSOP87FixedCoefficient L5JupiterFixedCoefficients[] =
+{
+    {50UL, 3595553506UL, 37080L},
+    {16UL, 3588717697UL, 74212L},
+    {4UL, 6835653UL, 2799513L},
+    {2UL, 751921819UL, 2725354L},
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0JupiterFixedCoefficients[] =
+{
+    {2268616UL, 2432484833UL, 2762439L},
+    {110090UL, 0UL, 0L},
+    {109972UL, 2671436652UL, 5524877L},
+    {8101UL, 2464321118UL, 2725340L},
+    {6438UL, 209376054UL, 2799537L},
+    {6044UL, 2911167816UL, 8287316L},
+    {1107UL, 2040647461UL, 6062526L},
+    {944UL, 1144971804UL, 2224789L},
+    {942UL, 2006947723UL, 5487776L},
+    {894UL, 1198973458UL, 37101L},
+    {836UL, 3540184494UL, 537650L},
+    {767UL, 1473083149UL, 3300088L},
+    {684UL, 2514153065UL, 1112395L},
+    {629UL, 439532477UL, 5561973L},
+    {559UL, 9569914UL, 4412483L},
+    {532UL, 1847676987UL, 574745L},
+    {464UL, 801822053UL, 4950133L},
+    {431UL, 1782738266UL, 2187694L},
+    {351UL, 3151919527UL, 11049755L},
+    {132UL, 3266074803UL, 3874833L},
+    {123UL, 2289943608UL, 8824966L},
+    {116UL, 948105013UL, 1687140L},
+    {115UL, 3451320930UL, 1650044L},
+    {104UL, 2529875068UL, 2688242L},
+    {103UL, 1585187878UL, 7712571L},
+    {102UL, 2155281393UL, 8250215L}
+};
+
+CONST VSOP87FixedCoefficient B1JupiterFixedCoefficients[] =
+{
+    {177352UL, 3897460155UL, 2762439L},
+    {3230UL, 3950597066UL, 5524877L},
+    {3081UL, 3742246347UL, 2725340L},
+    {2212UL, 3236544772UL, 2799537L},
+    {1694UL, 2147488597UL, 0L},
+    {346UL, 3244200670UL, 5487776L},
+    {234UL, 3547020304UL, 5561973L},
+    {196UL, 4228534706UL, 37101L},
+    {150UL, 2684360868UL, 8287316L},
+    {114UL, 2350780908UL, 3300088L},
+    {97UL, 1989175011UL, 4950153L},
+    {82UL, 3472511548UL, 6062501L},
+    {77UL, 1715748835UL, 537634L},
+    {77UL, 416974828UL, 2187668L},
+    {74UL, 3759609016UL, 2688222L},
+    {61UL, 3725430622UL, 1112400L},
+    {50UL, 2700082871UL, 3837753L},
+    {46UL, 369125263UL, 574766L},
+    {45UL, 1298774007UL, 4412467L},
+    {37UL, 3212756665UL, 2836646L},
+    {36UL, 4176583925UL, 1650034L},
+    {32UL, 3363141208UL, 8250220L}
+};
+
+CONST VSOP87FixedCoefficient B2JupiterFixedCoefficients[] =
+{
+    {8094UL, 1000192693UL, 2762439L},
+    {813UL, 2147488597UL, 0L},
+    {742UL, 654171980UL, 2725338L},
+    {399UL, 1981655686UL, 2799540L},
+    {342UL, 989118972UL, 5524877L},
+    {74UL, 280261761UL, 5487787L},
+    {46UL, 2378807172UL, 5561999L},
+    {30UL, 1319280946UL, 8287300L},
+    {29UL, 676729629UL, 2688222L},
+    {23UL, 2918823714UL, 37080L},
+    {14UL, 1996010657UL, 2836646L},
+    {12UL, 3568210595UL, 3300068L},
+    {11UL, 3335798623UL, 4950153L},
+    {6UL, 4244940387UL, 5450655L}
+};
+
+CONST VSOP87FixedCoefficient B3JupiterFixedCoefficients[] =
+{
+    {252UL, 2311134225UL, 2762439L},
+    {122UL, 1868183926UL, 2725338L},
+    {49UL, 710907861UL, 2799513L},
+    {11UL, 1579035747UL, 5487787L},
+    {8UL, 1893475800UL, 2688222L},
+    {7UL, 2905152421UL, 5524867L},
+    {6UL, 1216746171UL, 5561999L},
+    {4UL, 772428758UL, 2836646L},
+    {3UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B4JupiterFixedCoefficients[] =
+{
+    {15UL, 3096550842UL, 2725354L},
+    {5UL, 3055536638UL, 2762434L},
+    {4UL, 3718595138UL, 2799513L},
+    {3UL, 0UL, 0L},
+    {2UL, 3089715033UL, 2688222L},
+    {1UL, 2870974027UL, 5487787L}
+};
+
+CONST VSOP87FixedCoefficient B5JupiterFixedCoefficients[] =
+{
+    {1UL, 61520877UL, 2725354L}
+};
+
+CONST VSOP87FixedCoefficient R0JupiterFixedCoefficients[] =
+{
+    {520887457UL, 0UL, 0L},
+    {25209328UL, 2386385168UL, 2762439L},
+    {610600UL, 2625679560UL, 5524877L},
+    {282029UL, 1759633022UL, 3300087L},
+    {187647UL, 1419015816UL, 2725340L},
+    {86793UL, 485338176UL, 2187692L},
+    {72063UL, 146734125UL, 2799537L},
+    {65517UL, 4087692981UL, 1650043L},
+    {30135UL, 1477403282UL, 4950130L},
+    {29135UL, 1146742279UL, 537648L},
+    {23947UL, 187693355UL, 37099L},
+    {23453UL, 2419978320UL, 3837735L},
+    {22284UL, 2866619996UL, 8287316L},
+    {13033UL, 2023647085UL, 6062526L},
+    {12749UL, 1856221585UL, 5487779L},
+    {9703UL, 1303353921UL, 1075296L},
+    {9161UL, 3016915229UL, 1112395L},
+    {7895UL, 1694626667UL, 2224790L},
+    {7058UL, 1491402642UL, 6600174L},
+    {6138UL, 4281989743UL, 4412482L},
+    {5477UL, 3867133830UL, 3337185L},
+    {4170UL, 1378135904UL, 2688242L},
+    {4137UL, 1860801336UL, 3262989L},
+    {3503UL, 386419442UL, 5561976L},
+    {2617UL, 1373897911UL, 8250217L},
+    {2500UL, 3111452267UL, 4375384L},
+    {2128UL, 4188546265UL, 3874834L},
+    {1912UL, 585268575UL, 2150593L},
+    {1611UL, 2111328105UL, 7137822L},
+    {1479UL, 1832160006UL, 7712569L},
+    {1231UL, 1292211833UL, 1687142L},
+    {1217UL, 1231579554UL, 574747L},
+    {1015UL, 947899991UL, 2372439L},
+    {999UL, 1963199457UL, 1612943L},
+    {961UL, 3109538293UL, 11049755L},
+    {886UL, 2835428601UL, 2782945L},
+    {821UL, 1088919521UL, 9900259L},
+    {812UL, 4061061292UL, 4744878L},
+    {777UL, 2513469550UL, 3800637L},
+    {727UL, 2726058262UL, 6025426L},
+    {655UL, 1907830609UL, 8787865L},
+    {654UL, 2311817741UL, 8824966L},
+    {621UL, 3296835293UL, 4987228L},
+    {615UL, 1555794583UL, 4913032L},
+    {562UL, 55368787UL, 2836635L},
+    {542UL, 194132545UL, 2741933L}
+};
+
+CONST VSOP87FixedCoefficient R1JupiterFixedCoefficients[] =
+{
+    {1271802UL, 1811020726UL, 2762439L},
+    {61662UL, 2051215390UL, 5524877L},
+    {53444UL, 2663976976UL, 2725340L},
+    {41390UL, 0UL, 0L},
+    {31185UL, 3337692063UL, 2799537L},
+    {11847UL, 1649648105UL, 2187692L},
+    {9166UL, 3253633969UL, 37098L},
+    {3404UL, 2287824611UL, 8287316L},
+    {3203UL, 3561922055UL, 3837735L},
+    {3176UL, 1909197803UL, 537648L},
+    {2806UL, 2558037904UL, 2688242L},
+    {2677UL, 2960179512UL, 5487779L},
+    {2600UL, 2484349563UL, 1075296L},
+    {2412UL, 1004499135UL, 2224790L},
+    {2101UL, 2684770913UL, 3337185L},
+    {1646UL, 3629389979UL, 5561976L},
+    {1641UL, 3018829203UL, 3262989L},
+    {1050UL, 2160818132UL, 1112395L},
+    {1025UL, 1746030831UL, 2150593L},
+    {806UL, 1830587790UL, 3300088L},
+    {741UL, 1484020216UL, 6062527L},
+    {677UL, 4272282972UL, 4375382L},
+    {567UL, 3128678363UL, 3874833L},
+    {485UL, 1687722734UL, 4950133L},
+    {469UL, 3219592474UL, 2836635L},
+    {445UL, 275476804UL, 1687140L},
+    {416UL, 3669378420UL, 3800637L},
+    {402UL, 3147818107UL, 1612943L},
+    {347UL, 3199769214UL, 74196L},
+    {338UL, 2165534781UL, 4987228L},
+    {261UL, 3652289223UL, 4412483L},
+    {247UL, 2681626643UL, 4913032L},
+    {220UL, 3309823070UL, 7137821L},
+    {203UL, 3827965478UL, 6025426L},
+    {200UL, 3034346347UL, 5450681L},
+    {197UL, 2533292973UL, 11049755L},
+    {196UL, 2569521914UL, 1038198L},
+    {184UL, 2915405809UL, 500549L},
+    {180UL, 3009054309UL, 2779028L},
+    {170UL, 3312557458UL, 2745849L},
+    {146UL, 4190255218UL, 2782945L},
+    {133UL, 903673313UL, 574745L},
+    {132UL, 3084246581UL, 2741933L}
+};
+
+CONST VSOP87FixedCoefficient R2JupiterFixedCoefficients[] =
+{
+    {79645UL, 928732785UL, 2762439L},
+    {8252UL, 3949435057UL, 2725340L},
+    {7030UL, 2238539607UL, 2799537L},
+    {5314UL, 1256666407UL, 5524877L},
+    {1861UL, 2034837088UL, 37098L},
+    {964UL, 3745937723UL, 2688242L},
+    {836UL, 2870290511UL, 2187694L},
+    {498UL, 2147762068UL, 0L},
+    {427UL, 1522983383UL, 3337184L},
+    {406UL, 2585927432UL, 5561973L},
+    {377UL, 1532553418UL, 8287316L},
+    {363UL, 3669378420UL, 1075299L},
+    {342UL, 4169064600UL, 5487776L},
+    {339UL, 4188204344UL, 3262987L},
+    {333UL, 2050696UL, 2224789L},
+    {280UL, 2913355262UL, 2150593L},
+    {257UL, 658273360UL, 3300088L},
+    {230UL, 481913508UL, 3837738L},
+    {201UL, 2097861835UL, 2836635L},
+    {200UL, 3027510538UL, 537650L},
+    {139UL, 2004213335UL, 74196L},
+    {114UL, 537965872UL, 3800637L},
+    {95UL, 1162061001UL, 4375387L},
+    {86UL, 3513525425UL, 1687166L},
+    {83UL, 41013916UL, 1612954L},
+    {80UL, 2037024534UL, 3874833L},
+    {75UL, 1093704457UL, 4987233L},
+    {70UL, 1032183560UL, 1112400L},
+    {67UL, 3739101914UL, 1038188L},
+    {62UL, 4169748116UL, 5450655L},
+    {56UL, 656222650UL, 6062501L},
+    {52UL, 3814294186UL, 4913021L},
+    {50UL, 1859297569UL, 2779018L},
+    {45UL, 3773280308UL, 2651141L},
+    {44UL, 184562632UL, 2745849L},
+    {40UL, 4067213259UL, 500554L}
+};
+
+CONST VSOP87FixedCoefficient R3JupiterFixedCoefficients[] =
+{
+    {3519UL, 4141038499UL, 2762439L},
+    {1073UL, 1143741427UL, 2799537L},
+    {916UL, 965877726UL, 2725338L},
+    {342UL, 357504640UL, 5524877L},
+    {255UL, 817544056UL, 37101L},
+    {222UL, 650754157UL, 2688242L},
+    {90UL, 2146395037UL, 0L},
+    {69UL, 1551693163UL, 5561999L},
+    {58UL, 963827016UL, 2836646L},
+    {58UL, 362289576UL, 3337200L},
+    {51UL, 4087720361UL, 2150588L},
+    {47UL, 1080033165UL, 3262987L},
+    {43UL, 4183419408UL, 2187668L},
+    {37UL, 806606989UL, 74212L},
+    {34UL, 1141553981UL, 5487787L},
+    {34UL, 581030501UL, 1075320L},
+    {31UL, 710907861UL, 8287300L},
+    {30UL, 3164907304UL, 2224800L},
+    {21UL, 1708913189UL, 3800621L},
+    {15UL, 608373085UL, 1038188L},
+    {14UL, 656222650UL, 2651141L},
+    {13UL, 1025347913UL, 5450655L},
+    {12UL, 1784105298UL, 3837753L},
+    {12UL, 2433492342UL, 1687166L},
+    {11UL, 1223581817UL, 1612954L},
+    {11UL, 4292790074UL, 4987233L},
+    {10UL, 4279118782UL, 537634L},
+    {9UL, 2358300233UL, 4375387L}
+};
+
+CONST VSOP87FixedCoefficient R4JupiterFixedCoefficients[] =
+{
+    {129UL, 57419482UL, 2799540L},
+    {113UL, 2904468905UL, 2762439L},
+    {83UL, 2255765377UL, 2725354L},
+    {38UL, 1866133215UL, 2688222L},
+    {27UL, 3889486457UL, 37080L},
+    {18UL, 3691252553UL, 5524867L},
+    {13UL, 4115062946UL, 2836646L},
+    {9UL, 526345249UL, 5561999L},
+    {8UL, 3882650648UL, 74212L},
+    {7UL, 977498308UL, 2150588L},
+    {6UL, 3499854133UL, 3337200L},
+    {5UL, 2283107962UL, 3262987L},
+    {3UL, 2324122002UL, 5487787L},
+    {3UL, 2843631442UL, 3800621L},
+    {3UL, 1982339364UL, 2224800L}
+};
+
+CONST VSOP87FixedCoefficient R5JupiterFixedCoefficients[] =
+{
+    {11UL, 3246935059UL, 2799513L},
+    {4UL, 4046706484UL, 2725354L},
+    {2UL, 3807458702UL, 2688222L},
+    {2UL, 2939330815UL, 2836646L},
+    {2UL, 2522355906UL, 37080L},
+    {2UL, 2823124666UL, 5524867L},
+    {2UL, 3752773206UL, 5561999L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Saturn.
+//
+
+CONST VSOP87FixedCoefficient L0SaturnFixedCoefficients[] =
+{
+    {87401354UL, 0UL, 0L},
+    {11107660UL, 2708320425UL, 1112395L},
+    {1414151UL, 3134703862UL, 37098L},
+    {398379UL, 356219544UL, 1075297L},
+    {350769UL, 2258020457UL, 2224790L},
+    {206816UL, 168556259UL, 537648L},
+    {79271UL, 2624938514UL, 1149494L},
+    {23990UL, 3192092456UL, 574747L},
+    {16574UL, 298847900UL, 2187692L},
+    {15820UL, 641245767UL, 3300087L},
+    {15054UL, 1857041837UL, 3337185L},
+    {14907UL, 3943508646UL, 1650043L},
+    {14610UL, 1069909505UL, 20507L},
+    {13160UL, 3041120552UL, 74197L},
+    {13005UL, 4088533930UL, 57605L},
+    {10725UL, 2139149184UL, 1054790L},
+    {6126UL, 1205330611UL, 1444790L},
+    {5863UL, 161731542UL, 2762439L},
+    {5228UL, 2876305906UL, 16592L},
+    {5020UL, 2172302141UL, 2261889L},
+    {4593UL, 423673738UL, 1038198L},
+    {4006UL, 1534467393UL, 332395L},
+    {3874UL, 2202994181UL, 722395L},
+    {3269UL, 529694745UL, 4950130L},
+    {2954UL, 671807958UL, 500550L},
+    {2461UL, 1388731213UL, 3837735L},
+    {1758UL, 2232387476UL, 2725340L},
+    {1640UL, 3763026920UL, 4412482L},
+    {1581UL, 2989026027UL, 1612945L},
+    {1391UL, 2750188290UL, 1687142L},
+    {1124UL, 1939479799UL, 2167185L},
+    {1087UL, 2859627079UL, 12765L},
+    {1017UL, 2540812135UL, 1186592L},
+    {957UL, 346567615UL, 6600171L},
+    {853UL, 2338476810UL, 913524L},
+    {849UL, 2181256784UL, 1091889L},
+    {789UL, 3422611314UL, 5022L},
+    {749UL, 1465563987UL, 4449578L},
+    {744UL, 3590768244UL, 1170002L},
+    {687UL, 1194188522UL, 5487776L},
+    {654UL, 1093020860UL, 250L},
+    {634UL, 1571516585UL, 2150593L},
+    {625UL, 663058337UL, 1095805L},
+    {580UL, 2114267353UL, 390002L},
+    {546UL, 1453943405UL, 1827048L},
+    {543UL, 1037652093UL, 49862L},
+    {530UL, 3041181830UL, 611846L},
+    {478UL, 2026770983UL, 714653L},
+    {474UL, 3742519819UL, 3874833L},
+    {452UL, 713642168UL, 2557185L},
+    {449UL, 881799179UL, 664791L},
+    {372UL, 1557161777UL, 1132901L},
+    {355UL, 2059582183UL, 4375382L},
+    {347UL, 1052006983UL, 1777185L},
+    {343UL, 168157062UL, 2717L},
+    {330UL, 168840619UL, 8250215L},
+    {322UL, 656906247UL, 1062532L},
+    {322UL, 1758129907UL, 3374285L},
+    {309UL, 2389060560UL, 1128984L},
+    {287UL, 1620049625UL, 1834792L},
+    {278UL, 273426114UL, 1104655L},
+    {249UL, 1004840975UL, 7137821L},
+    {227UL, 3356305399UL, 65346L},
+    {220UL, 2873708416UL, 1047048L},
+    {209UL, 919395315UL, 3262987L},
+    {208UL, 330162035UL, 6062527L},
+    {208UL, 877014243UL, 205254L},
+    {204UL, 4108910978UL, 1387183L},
+    {185UL, 2394529175UL, 779999L},
+    {184UL, 665109006UL, 21867L},
+    {182UL, 3753457048UL, 15234L},
+    {174UL, 1273482133UL, 3917L},
+    {165UL, 300768720UL, 28251L},
+    {149UL, 3920930462UL, 274788L},
+    {148UL, 1049272675UL, 29356L},
+    {146UL, 4259295196UL, 1017692L},
+    {140UL, 2935912911UL, 111297L},
+    {131UL, 2780743432UL, 53690L},
+    {125UL, 4290739201UL, 9900259L},
+    {122UL, 1350724951UL, 24334L},
+    {118UL, 3650922192UL, 2889580L},
+    {117UL, 1831271305UL, 6025426L},
+    {114UL, 3823864058UL, 5524877L},
+    {112UL, 755339643UL, 997186L},
+    {110UL, 113471831UL, 7739L},
+    {109UL, 2350097393UL, 2799540L},
+    {107UL, 2742463943UL, 4987228L},
+    {104UL, 1498375024UL, 463453L},
+    {103UL, 818227653UL, 8787865L},
+    {101UL, 3393901698UL, 1407689L}
+};
+
+CONST VSOP87FixedCoefficient L1SaturnFixedCoefficients[] =
+{
+    {2669287070UL, 0UL, 0L},
+    {162107UL, 1249697447UL, 1112395L},
+    {70544UL, 1972086465UL, 37098L},
+    {13460UL, 1556955940UL, 1075297L},
+    {12290UL, 738729021UL, 2224790L},
+    {5032UL, 1395348147UL, 1149494L},
+    {2493UL, 874655919UL, 537648L},
+    {1314UL, 1878984256UL, 74197L},
+    {867UL, 276775590UL, 3337185L},
+    {600UL, 1669198057UL, 2187691L},
+    {507UL, 1997172666UL, 574747L},
+    {471UL, 2494808136UL, 20507L},
+    {423UL, 1652108860UL, 16592L},
+    {413UL, 863069479UL, 2261889L},
+    {384UL, 1590929801UL, 1038198L},
+    {244UL, 2436158281UL, 57605L},
+    {156UL, 1796409559UL, 500550L},
+    {115UL, 1340471482UL, 1186591L},
+    {88UL, 3019307697UL, 2762439L},
+    {81UL, 4220331865UL, 1054788L},
+    {79UL, 4177267441UL, 1612943L},
+    {61UL, 4128734238UL, 4449578L},
+    {60UL, 3409623537UL, 2725338L},
+    {59UL, 3156020948UL, 332395L},
+    {52UL, 1447107759UL, 1687140L},
+    {51UL, 887951310UL, 1091889L},
+    {44UL, 1583820684UL, 3300088L},
+    {43UL, 2706235002UL, 2150593L},
+    {42UL, 2484076254UL, 1650044L},
+    {42UL, 2578408270UL, 3837738L},
+    {41UL, 1955680295UL, 1095805L},
+    {36UL, 1868183926UL, 611846L},
+    {35UL, 3926398914UL, 12767L},
+    {33UL, 371175933UL, 3374285L},
+    {29UL, 1123781350UL, 1128984L},
+    {24UL, 2026770983UL, 1170002L},
+    {22UL, 2786895725UL, 4412483L},
+    {21UL, 1775218941UL, 111297L},
+    {17UL, 1562630229UL, 53690L},
+    {16UL, 2352148103UL, 3874833L},
+    {16UL, 2799199660UL, 1132901L},
+    {14UL, 4211445509UL, 2167182L},
+    {12UL, 3233263767UL, 4375387L},
+    {12UL, 2378807172UL, 5487787L},
+    {12UL, 2700082871UL, 463474L},
+    {11UL, 833949656UL, 2299012L},
+    {10UL, 2125887935UL, 3262987L},
+    {10UL, 4265447163UL, 1575822L},
+    {8UL, 198233924UL, 24355L},
+    {8UL, 3862143872UL, 49857L},
+    {8UL, 2932495006UL, 664780L},
+    {8UL, 1250924484UL, 1017692L},
+    {7UL, 1695241896UL, 1001108L},
+    {7UL, 3431497670UL, 714637L},
+    {7UL, 191398278UL, 389992L},
+    {7UL, 3506689942UL, 2557164L},
+    {6UL, 998005328UL, 2799513L},
+    {6UL, 806606989UL, 779984L},
+    {6UL, 3520361234UL, 2688222L},
+    {6UL, 1524350578UL, 4987233L},
+    {6UL, 1852461923UL, 28266L},
+    {5UL, 280261761UL, 1407684L},
+    {5UL, 2659068994UL, 3800621L},
+    {5UL, 444317413UL, 2204304L},
+    {5UL, 1729420128UL, 65346L},
+    {5UL, 2583876722UL, 15228L},
+    {4UL, 4156076823UL, 29362L},
+    {4UL, 2194244561UL, 7137821L},
+    {4UL, 3171742787UL, 1444764L},
+    {4UL, 3711759329UL, 5561999L},
+    {4UL, 205069591UL, 1834808L},
+    {4UL, 3000851469UL, 6025421L},
+    {4UL, 1661063665UL, 274788L},
+    {4UL, 1941325324UL, 1058683L},
+    {4UL, 4231269095UL, 1481896L},
+    {4UL, 2317286356UL, 5524867L},
+    {4UL, 1387637490UL, 1724246L},
+    {4UL, 1872968862UL, 1387188L},
+    {3UL, 3082879549UL, 1777180L}
+};
+
+CONST VSOP87FixedCoefficient L2SaturnFixedCoefficients[] =
+{
+    {116441UL, 806524280UL, 37098L},
+    {91921UL, 50754720UL, 1112395L},
+    {90592UL, 0UL, 0L},
+    {15277UL, 2778638125UL, 1075297L},
+    {10631UL, 176209447UL, 1149494L},
+    {10605UL, 3697841945UL, 2224790L},
+    {4265UL, 715009281UL, 74197L},
+    {1216UL, 1995053670UL, 537648L},
+    {1165UL, 3150825641UL, 3337185L},
+    {1082UL, 3890374995UL, 2261889L},
+    {1045UL, 2763039168UL, 1038198L},
+    {1020UL, 433175324UL, 16592L},
+    {634UL, 2999484437UL, 2187694L},
+    {549UL, 3809509249UL, 20506L},
+    {457UL, 866760774UL, 574745L},
+    {425UL, 142865147UL, 1186591L},
+    {274UL, 2931127975UL, 500549L},
+    {162UL, 944003674UL, 57607L},
+    {129UL, 1070463211UL, 1612943L},
+    {117UL, 2652916863UL, 4449578L},
+    {105UL, 3349469916UL, 3374285L},
+    {101UL, 610423796UL, 111297L},
+    {96UL, 1989175011UL, 1650034L},
+    {95UL, 3848472580UL, 2150588L},
+    {85UL, 3916829042UL, 1091904L},
+    {83UL, 4135570048UL, 1128984L},
+    {82UL, 697236568UL, 611846L},
+    {75UL, 3253770868UL, 1095816L},
+    {67UL, 314440032UL, 2725354L},
+    {66UL, 328111325UL, 53664L},
+    {64UL, 239247842UL, 1687166L},
+    {61UL, 3335798623UL, 3300068L},
+    {53UL, 1879804508UL, 2762434L},
+    {46UL, 3889486457UL, 2299012L},
+    {45UL, 1141553981UL, 1054772L},
+    {42UL, 3903157750UL, 463474L},
+    {32UL, 47849569UL, 332416L},
+    {32UL, 1141553981UL, 1575822L},
+    {31UL, 2843631442UL, 1001108L},
+    {27UL, 567359167UL, 1169976L},
+    {25UL, 3868979355UL, 3837753L},
+    {20UL, 4060377776UL, 1132896L},
+    {18UL, 3349469916UL, 3262987L},
+    {17UL, 1114211396UL, 3874833L},
+    {16UL, 396467848UL, 2688222L},
+    {14UL, 143548703UL, 4375387L},
+    {14UL, 2570205430UL, 1017692L},
+    {12UL, 3226427957UL, 1058683L},
+    {12UL, 88863483UL, 1223692L},
+    {12UL, 2132723582UL, 4412467L},
+    {11UL, 4046706484UL, 2799513L},
+    {11UL, 3827965478UL, 3800621L},
+    {11UL, 2187408914UL, 5561999L},
+    {10UL, 3410990569UL, 2204304L},
+    {10UL, 177726965UL, 1724246L},
+    {10UL, 2836795959UL, 4486679L},
+    {9UL, 314440032UL, 4987233L},
+    {8UL, 1462829761UL, 1407684L},
+    {8UL, 3588717697UL, 2241384L},
+    {8UL, 2754768204UL, 49857L},
+    {7UL, 3691252553UL, 5487787L},
+    {6UL, 3048701155UL, 1481896L},
+    {6UL, 4053541967UL, 2113508L}
+};
+
+CONST VSOP87FixedCoefficient L3SaturnFixedCoefficients[] =
+{
+    {16039UL, 3923288706UL, 37099L},
+    {4250UL, 3134420286UL, 1112395L},
+    {1907UL, 3254317485UL, 1149493L},
+    {1466UL, 4042126570UL, 1075296L},
+    {1162UL, 3841431748UL, 74197L},
+    {1067UL, 2466440277UL, 2224790L},
+    {239UL, 2639245571UL, 2261890L},
+    {237UL, 3942804596UL, 1038198L},
+    {166UL, 3497120070UL, 16590L},
+    {151UL, 1870234636UL, 3337184L},
+    {131UL, 3242150123UL, 1186591L},
+    {63UL, 157220016UL, 2187668L},
+    {62UL, 3240099250UL, 537634L},
+    {40UL, 3739101914UL, 111292L},
+    {40UL, 4074049069UL, 500554L},
+    {39UL, 3985185504UL, 574766L},
+    {28UL, 2057531473UL, 3374280L},
+    {25UL, 676729629UL, 20496L},
+    {19UL, 1312445300UL, 4449599L},
+    {18UL, 3397319276UL, 53664L},
+    {18UL, 704072214UL, 2150588L},
+    {18UL, 2870974027UL, 1128984L},
+    {18UL, 2269436669UL, 1612954L},
+    {16UL, 2665904640UL, 2299012L},
+    {16UL, 3841636771UL, 611846L},
+    {13UL, 806606989UL, 463474L},
+    {11UL, 3814294186UL, 57628L},
+    {11UL, 4053541967UL, 1001108L},
+    {10UL, 2700082871UL, 1091904L},
+    {9UL, 2317286356UL, 1575822L},
+    {8UL, 3335798623UL, 1687166L},
+    {7UL, 259754801UL, 3300068L},
+    {6UL, 1538021870UL, 2725354L},
+    {6UL, 724579153UL, 1095816L},
+    {5UL, 3171742787UL, 1223692L},
+    {4UL, 2146395037UL, 0L},
+    {4UL, 1579035747UL, 2688222L},
+    {3UL, 1503843639UL, 4486679L},
+    {3UL, 403303495UL, 2762434L},
+    {3UL, 3369976691UL, 1169976L},
+    {3UL, 287097407UL, 3262987L},
+    {2UL, 3260606351UL, 1724246L},
+    {2UL, 2289943608UL, 2241384L},
+    {2UL, 2187408914UL, 1054772L},
+    {2UL, 813442717UL, 5561999L},
+    {2UL, 922813138UL, 2113508L},
+    {2UL, 2843631442UL, 1166064L},
+    {2UL, 2098545350UL, 3411360L}
+};
+
+CONST VSOP87FixedCoefficient L4SaturnFixedCoefficients[] =
+{
+    {1662UL, 2733099093UL, 37098L},
+    {257UL, 2039758760UL, 1149495L},
+    {236UL, 2667271671UL, 74196L},
+    {149UL, 1873652377UL, 1112395L},
+    {114UL, 2147762068UL, 0L},
+    {110UL, 1035601383UL, 1075299L},
+    {68UL, 1175732294UL, 2224800L},
+    {40UL, 1401308782UL, 2261880L},
+    {38UL, 847620948UL, 1038188L},
+    {31UL, 2057531473UL, 1186612L},
+    {15UL, 567359167UL, 3337200L},
+    {9UL, 2536027198UL, 111292L},
+    {6UL, 1654228019UL, 2187668L},
+    {6UL, 792935697UL, 3374280L},
+    {4UL, 991169682UL, 500554L},
+    {4UL, 1449158306UL, 2299012L},
+    {3UL, 2795782081UL, 574766L},
+    {3UL, 1893475800UL, 2150588L},
+    {3UL, 2057531473UL, 463474L},
+    {3UL, 0UL, 4449599L},
+    {3UL, 266590448UL, 537634L},
+    {2UL, 2583876722UL, 611846L},
+    {2UL, 1934489678UL, 1223692L},
+    {2UL, 3472511548UL, 1612954L},
+    {2UL, 1531186224UL, 1128984L},
+    {2UL, 3547703819UL, 1575822L},
+    {1UL, 1059526145UL, 1001108L}
+};
+
+CONST VSOP87FixedCoefficient L5SaturnFixedCoefficients[] =
+{
+    {124UL, 1544174001UL, 37101L},
+    {34UL, 1476501054UL, 74212L},
+    {28UL, 820278363UL, 1149480L},
+    {6UL, 833949656UL, 1186612L},
+    {5UL, 164055662UL, 2261880L},
+    {4UL, 4258611680UL, 2224800L},
+    {3UL, 2030188888UL, 1038188L},
+    {3UL, 2932495006UL, 1075320L},
+    {2UL, 4272282972UL, 1112400L},
+    {1UL, 3609224798UL, 3337200L},
+    {1UL, 164055662UL, 2299012L},
+    {1UL, 2146395037UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0SaturnFixedCoefficients[] =
+{
+    {4330678UL, 2462779052UL, 1112395L},
+    {240348UL, 1949791369UL, 2224790L},
+    {84746UL, 0UL, 0L},
+    {34116UL, 391662378UL, 1075297L},
+    {30863UL, 2381828559UL, 1149494L},
+    {14734UL, 1448112498UL, 3337185L},
+    {9917UL, 3957842920UL, 2187691L},
+    {6994UL, 3237365187UL, 37098L},
+    {4808UL, 3713878652UL, 1650044L},
+    {4788UL, 3393969821UL, 574747L},
+    {3432UL, 1867910454UL, 2261889L},
+    {1506UL, 4110278010UL, 537648L},
+    {1060UL, 3849156095UL, 2762439L},
+    {969UL, 3557273691UL, 3300088L},
+    {942UL, 954257144UL, 4449578L},
+    {708UL, 2599598725UL, 1687140L},
+    {552UL, 3507373458UL, 1054788L},
+    {400UL, 2296095738UL, 1186591L},
+    {319UL, 2478607640UL, 1091889L},
+    {316UL, 1365079841UL, 3374285L},
+    {314UL, 317857856UL, 1132901L},
+    {284UL, 3339900043UL, 1170002L},
+    {236UL, 1462146083UL, 57607L},
+    {215UL, 4067213259UL, 4412483L},
+    {209UL, 1449158306UL, 2167182L},
+    {207UL, 499002664UL, 1038198L},
+    {179UL, 2019251821UL, 332395L},
+    {141UL, 440216033UL, 2557185L},
+    {139UL, 3140982298UL, 74196L},
+    {139UL, 1365763438UL, 3837738L},
+    {135UL, 3585299792UL, 3874833L},
+    {122UL, 2129305840UL, 2725338L},
+    {116UL, 2125204420UL, 1128984L},
+    {114UL, 658273360UL, 1095805L}
+};
+
+CONST VSOP87FixedCoefficient B1SaturnFixedCoefficients[] =
+{
+    {397555UL, 3645385290UL, 1112395L},
+    {49479UL, 2147481915UL, 0L},
+    {18572UL, 4169194654UL, 2224790L},
+    {14801UL, 1576205855UL, 1075297L},
+    {9644UL, 1159805187UL, 1149493L},
+    {3757UL, 857395924UL, 2187691L},
+    {2717UL, 4041032684UL, 3337185L},
+    {1455UL, 582124183UL, 2261889L},
+    {1291UL, 1994438440UL, 37098L},
+    {853UL, 298034453UL, 1650044L},
+    {298UL, 628196508UL, 3300088L},
+    {292UL, 3633832995UL, 4449578L},
+    {284UL, 1106692152UL, 1186591L},
+    {275UL, 2658385315UL, 537650L},
+    {172UL, 35545395UL, 3374285L},
+    {166UL, 1670633537UL, 1038198L},
+    {158UL, 3560691596UL, 574745L},
+    {128UL, 825063299UL, 2762439L},
+    {110UL, 1679519894UL, 1132901L},
+    {82UL, 1886640154UL, 1095816L},
+    {81UL, 1954996616UL, 74212L},
+    {69UL, 1134718335UL, 1054772L},
+    {65UL, 861292241UL, 1128984L},
+    {61UL, 854456594UL, 1091904L},
+    {59UL, 1244088837UL, 1687166L},
+    {46UL, 560523521UL, 2299012L},
+    {36UL, 1244088837UL, 1169976L},
+    {34UL, 1941325324UL, 611846L},
+    {33UL, 895470472UL, 2150588L},
+    {32UL, 813442717UL, 4412467L},
+    {27UL, 3178578597UL, 5561999L},
+    {27UL, 3035029863UL, 57628L}
+};
+
+CONST VSOP87FixedCoefficient B2SaturnFixedCoefficients[] =
+{
+    {20630UL, 345077415UL, 1112395L},
+    {3720UL, 2733099093UL, 1075296L},
+    {1627UL, 4225732194UL, 1149493L},
+    {1346UL, 0UL, 0L},
+    {706UL, 2077354896UL, 2187694L},
+    {365UL, 3485499325UL, 2224789L},
+    {330UL, 3608540957UL, 2261890L},
+    {219UL, 2616687922UL, 3337184L},
+    {139UL, 712958571UL, 37101L},
+    {104UL, 4208711446UL, 1186591L},
+    {93UL, 1353459259UL, 1650034L},
+    {71UL, 2836795959UL, 1038188L},
+    {52UL, 1968668072UL, 3300068L},
+    {49UL, 3028194053UL, 3374280L},
+    {41UL, 2160066329UL, 4449599L},
+    {29UL, 3096550842UL, 1095816L},
+    {24UL, 765593112UL, 74212L},
+    {21UL, 2973508884UL, 1132896L},
+    {20UL, 3629731574UL, 2299012L},
+    {18UL, 581030501UL, 574766L},
+    {17UL, 3882650648UL, 1128984L},
+    {16UL, 2911988230UL, 537634L},
+    {14UL, 2050695827UL, 2150588L},
+    {12UL, 1729420128UL, 2762434L},
+    {8UL, 2269436669UL, 1054772L},
+    {7UL, 3800622893UL, 1091904L},
+    {7UL, 198233924UL, 1687166L},
+    {6UL, 792935697UL, 611846L},
+    {6UL, 2467670573UL, 4486679L}
+};
+
+CONST VSOP87FixedCoefficient B3SaturnFixedCoefficients[] =
+{
+    {666UL, 1360294905UL, 1112395L},
+    {632UL, 3894954909UL, 1075299L},
+    {398UL, 0UL, 0L},
+    {188UL, 2965306043UL, 1149495L},
+    {92UL, 3308456038UL, 2187668L},
+    {52UL, 2337793295UL, 2261880L},
+    {42UL, 1626885434UL, 2224800L},
+    {26UL, 3007687278UL, 1186612L},
+    {21UL, 3998856797UL, 1038188L},
+    {18UL, 1360294905UL, 3337200L},
+    {11UL, 3670745452UL, 37080L},
+    {10UL, 1743091420UL, 3374280L},
+    {7UL, 2365135880UL, 1650034L},
+    {6UL, 3281113453UL, 3300068L},
+    {6UL, 13671305UL, 1095816L},
+    {6UL, 2406149757UL, 2299012L},
+    {5UL, 3855308063UL, 74212L},
+    {5UL, 833949656UL, 4449599L},
+    {4UL, 3219592474UL, 2150588L},
+    {3UL, 430646120UL, 537634L},
+    {2UL, 2542862845UL, 1128984L}
+};
+
+CONST VSOP87FixedCoefficient B4SaturnFixedCoefficients[] =
+{
+    {80UL, 765593112UL, 1075320L},
+    {32UL, 2132723582UL, 1112400L},
+    {17UL, 1695241896UL, 1149480L},
+    {12UL, 2146395037UL, 0L},
+    {9UL, 259754801UL, 2187668L},
+    {6UL, 1066361791UL, 2261880L},
+    {5UL, 1797776753UL, 1186612L},
+    {5UL, 874963533UL, 1038188L},
+    {1UL, 977498308UL, 2224800L},
+    {1UL, 457988746UL, 3374280L},
+    {1UL, 1175732294UL, 2299012L},
+    {1UL, 4224433286UL, 3337200L}
+};
+
+CONST VSOP87FixedCoefficient B5SaturnFixedCoefficients[] =
+{
+    {8UL, 1927654031UL, 1075320L},
+    {1UL, 348618284UL, 1149480L}
+};
+
+CONST VSOP87FixedCoefficient R0SaturnFixedCoefficients[] =
+{
+    {955758117UL, 0UL, 0L},
+    {52921384UL, 1635267221UL, 1112395L},
+    {1873680UL, 3578803296UL, 1075297L},
+    {1464664UL, 1126262639UL, 2224790L},
+    {821891UL, 4057096770UL, 1650043L},
+    {547507UL, 3428302715UL, 537648L},
+    {371684UL, 1552477886UL, 1149494L},
+    {361778UL, 2145740857UL, 37098L},
+    {140618UL, 3899102288UL, 3300087L},
+    {108975UL, 2251073336UL, 574747L},
+    {69007UL, 4061061292UL, 2187692L},
+    {61053UL, 642811098UL, 3337185L},
+    {48913UL, 1064536719UL, 1054790L},
+    {34144UL, 133425104UL, 1444790L},
+    {32402UL, 3739683082UL, 4950130L},
+    {20937UL, 316825676UL, 3837735L},
+    {20839UL, 1039723256UL, 2261889L},
+    {20747UL, 3645152889UL, 1038198L},
+    {15298UL, 2091326877UL, 2762439L},
+    {14296UL, 1780236442UL, 1687142L},
+    {12884UL, 1127144495UL, 722395L},
+    {11993UL, 4088069127UL, 4412482L},
+    {11380UL, 1183292525UL, 2725340L},
+    {9796UL, 3557820634UL, 6600174L},
+    {7753UL, 4000155705UL, 500550L},
+    {6771UL, 2053635238UL, 74197L},
+    {6466UL, 121196128UL, 5487779L},
+    {5850UL, 994724160UL, 2167185L},
+    {5307UL, 408361902UL, 332395L},
+    {4696UL, 1469118465UL, 1186592L},
+    {4044UL, 1121115410UL, 1091888L},
+    {3688UL, 533317631UL, 2150593L},
+    {3461UL, 1265211005UL, 913524L},
+    {3420UL, 3380572000UL, 8250217L},
+    {3401UL, 378626808UL, 1827048L},
+    {3376UL, 2525978833UL, 1170001L},
+    {2976UL, 3885863530UL, 1095804L},
+    {2885UL, 948515139UL, 4375384L},
+    {2881UL, 122768324UL, 4449581L},
+    {2508UL, 2418795776UL, 3874834L},
+    {2448UL, 4227236124UL, 7137822L},
+    {2406UL, 2027181191UL, 611845L},
+    {2174UL, 10321836UL, 1777185L},
+    {2024UL, 3454807284UL, 57605L}
+};
+
+CONST VSOP87FixedCoefficient R1SaturnFixedCoefficients[] =
+{
+    {6182981UL, 176657199UL, 1112395L},
+    {506578UL, 486115402UL, 1075297L},
+    {341394UL, 3962189128UL, 2224790L},
+    {188491UL, 322750131UL, 1149494L},
+    {186262UL, 2147483871UL, 0L},
+    {143891UL, 962083268UL, 37098L},
+    {49621UL, 4113312924UL, 537648L},
+    {20928UL, 3481028930UL, 3337185L},
+    {19953UL, 803599373UL, 2187692L},
+    {18840UL, 1099309645UL, 574747L},
+    {13877UL, 518730340UL, 1038198L},
+    {12893UL, 4062633345UL, 2261889L},
+    {5397UL, 880773824UL, 74197L},
+    {4869UL, 593266312UL, 1687142L},
+    {4247UL, 268641158UL, 1186592L},
+    {3252UL, 860266886UL, 500550L},
+    {3081UL, 2349140405UL, 2725340L},
+    {2909UL, 3149048566UL, 1054790L},
+    {2856UL, 1481491012UL, 3837735L},
+    {1988UL, 1675076716UL, 2150593L},
+    {1941UL, 4117728885UL, 1091888L},
+    {1581UL, 883098006UL, 1095804L},
+    {1340UL, 2944799267UL, 4449581L},
+    {1316UL, 856507305UL, 611845L},
+    {1203UL, 1275874601UL, 1650044L},
+    {1091UL, 51472466UL, 1128987L},
+    {966UL, 328111325UL, 3300088L},
+    {954UL, 3521728266UL, 3374285L},
+    {898UL, 671944653UL, 2762439L},
+    {882UL, 1288520538UL, 5487776L},
+    {874UL, 958358482UL, 1170002L},
+    {785UL, 2094443930UL, 4375382L},
+    {740UL, 944687190UL, 3262987L},
+    {658UL, 2832694538UL, 1612943L},
+    {650UL, 1179150117UL, 3874833L},
+    {613UL, 2073253476UL, 332395L},
+    {599UL, 1742407904UL, 1132901L},
+    {503UL, 1455994115UL, 20506L}
+};
+
+CONST VSOP87FixedCoefficient R2SaturnFixedCoefficients[] =
+{
+    {436902UL, 3272033483UL, 1112395L},
+    {71923UL, 1709391683UL, 1075297L},
+    {49767UL, 3398467922UL, 1149494L},
+    {43221UL, 2644987494UL, 2224790L},
+    {29646UL, 4076168065UL, 37099L},
+    {4721UL, 1692029177UL, 1038198L},
+    {4142UL, 2807197479UL, 2261889L},
+    {3789UL, 2117480236UL, 3337185L},
+    {2964UL, 937919912UL, 537648L},
+    {2556UL, 1948639464UL, 2187691L},
+    {2327UL, 0UL, 0L},
+    {2208UL, 4289987236UL, 574747L},
+    {2188UL, 4002616622UL, 74197L},
+    {1957UL, 3366217192UL, 1186592L},
+    {924UL, 3735000820UL, 1687140L},
+    {706UL, 2030872404UL, 500549L},
+    {546UL, 2822441151UL, 2150593L},
+    {431UL, 3539500979UL, 2725338L},
+    {405UL, 2852517798UL, 1091889L},
+    {391UL, 3063055963UL, 1128984L},
+    {374UL, 3987919893UL, 611846L},
+    {361UL, 2240043374UL, 3374285L},
+    {356UL, 2181940300UL, 1095805L},
+    {326UL, 1551009647UL, 4449578L},
+    {207UL, 2749299426UL, 3837738L},
+    {204UL, 60153744UL, 1054788L},
+    {180UL, 2458784217UL, 3300088L},
+    {178UL, 2800567017UL, 2298986L},
+    {154UL, 2142977132UL, 3262987L},
+    {148UL, 92964883UL, 1575848L},
+    {133UL, 1773168394UL, 1001097L},
+    {132UL, 4055592840UL, 1612943L}
+};
+
+CONST VSOP87FixedCoefficient R3SaturnFixedCoefficients[] =
+{
+    {20315UL, 2065645329UL, 1112395L},
+    {8924UL, 2181530255UL, 1149493L},
+    {6909UL, 2974670893UL, 1075296L},
+    {4087UL, 2887448158UL, 37098L},
+    {3879UL, 1374376405UL, 2224790L},
+    {1071UL, 2873434944UL, 1038198L},
+    {907UL, 1560579519UL, 2261890L},
+    {606UL, 2170319717UL, 1186591L},
+    {597UL, 2826542571UL, 74196L},
+    {483UL, 801822053UL, 3337184L},
+    {393UL, 0UL, 0L},
+    {229UL, 3211389633UL, 2187694L},
+    {188UL, 3137564719UL, 574745L},
+    {150UL, 2188775946UL, 537650L},
+    {121UL, 2575673881UL, 1687140L},
+    {102UL, 3219592474UL, 500549L},
+    {101UL, 3977666180UL, 2150593L},
+    {93UL, 984334036UL, 3374280L},
+    {84UL, 1797776753UL, 1128984L},
+    {73UL, 2836795959UL, 611846L},
+    {62UL, 1579035747UL, 2299012L},
+    {55UL, 211905237UL, 4449599L},
+    {50UL, 1633721080UL, 1091904L},
+    {45UL, 2987180176UL, 1001108L},
+    {41UL, 471660039UL, 2725354L},
+    {40UL, 1257760130UL, 1575822L},
+    {38UL, 4060377776UL, 463474L},
+    {32UL, 2741096912UL, 111292L}
+};
+
+CONST VSOP87FixedCoefficient R4SaturnFixedCoefficients[] =
+{
+    {1202UL, 967244839UL, 1149493L},
+    {708UL, 794302810UL, 1112395L},
+    {516UL, 4265447163UL, 1075299L},
+    {427UL, 1687722734UL, 37101L},
+    {268UL, 127826711UL, 2224789L},
+    {170UL, 4073365553UL, 1038198L},
+    {150UL, 328111325UL, 2261890L},
+    {145UL, 985701149UL, 1186591L},
+    {121UL, 1643974468UL, 74196L},
+    {47UL, 3807458702UL, 3337200L},
+    {19UL, 4005692606UL, 3374280L},
+    {17UL, 362289576UL, 2299012L},
+    {16UL, 1982339364UL, 574766L},
+    {15UL, 205069591UL, 2187668L},
+    {14UL, 888634826UL, 2150588L},
+    {13UL, 1428651367UL, 1687166L},
+    {11UL, 150384360UL, 500554L},
+    {11UL, 1681570604UL, 611846L},
+    {10UL, 2146395037UL, 0L},
+    {9UL, 1066361791UL, 463474L},
+    {9UL, 1558528809UL, 111292L},
+    {9UL, 464824392UL, 1128984L},
+    {8UL, 868127887UL, 1223692L}
+};
+
+CONST VSOP87FixedCoefficient R5SaturnFixedCoefficients[] =
+{
+    {129UL, 4041921547UL, 1149495L},
+    {32UL, 471660039UL, 37080L},
+    {27UL, 4039870674UL, 1186612L},
+    {20UL, 3383647984UL, 2261880L},
+    {20UL, 457988746UL, 74212L},
+    {14UL, 1825119338UL, 1075320L},
+    {14UL, 998005328UL, 1038188L},
+    {13UL, 3137564719UL, 2224800L},
+    {7UL, 3164907304UL, 1112400L},
+    {5UL, 2467670573UL, 3337200L},
+    {4UL, 3349469916UL, 2299012L},
+    {3UL, 2782110789UL, 3374280L},
+    {3UL, 3185414080UL, 1001108L},
+    {3UL, 334946992UL, 1687166L},
+    {3UL, 2173737622UL, 2187668L},
+    {2UL, 2529191552UL, 463474L},
+    {2UL, 2269436669UL, 500554L},
+    {2UL, 382796556UL, 611846L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Uranus.
+//
+
+CONST VSOP87FixedCoefficient L0UranusFixedCoefficients[] =
+{
+    {548129335UL, 0UL, 0L},
+    {9260408UL, 609100401UL, 390000L},
+    {1504248UL, 2479422513UL, 7742L},
+    {365982UL, 1298515611UL, 382258L},
+    {272328UL, 2295574220UL, 780000L},
+    {70328UL, 3686153076UL, 332395L},
+    {68893UL, 4164908420UL, 397742L},
+    {61999UL, 1551365095UL, 15484L},
+    {61951UL, 1948837804UL, 57605L},
+    {26469UL, 2147434000UL, 374517L},
+    {25711UL, 4179181415UL, 2372438L},
+    {21079UL, 2980747892UL, 772259L},
+    {17819UL, 1192390749UL, 191129L},
+    {14613UL, 3238267415UL, 20507L},
+    {11163UL, 3983011748UL, 1170001L},
+    {10998UL, 334024168UL, 722395L},
+    {9527UL, 2020072073UL, 183387L},
+    {7546UL, 3579352847UL, 573388L},
+    {4220UL, 2210171585UL, 369493L},
+    {4052UL, 1556819856UL, 787742L},
+    {3490UL, 3748056720UL, 764517L},
+    {3355UL, 728338815UL, 23225L},
+    {3144UL, 3248302090UL, 405484L},
+    {2927UL, 3164223788UL, 49863L},
+    {2922UL, 3658714662UL, 447606L},
+    {2273UL, 2984446113UL, 366775L},
+    {2149UL, 415265916UL, 198871L},
+    {2051UL, 1037446989UL, 584L},
+    {1992UL, 3366148742UL, 1444790L},
+    {1667UL, 2479564627UL, 1982438L},
+    {1533UL, 1767631493UL, 274789L},
+    {1376UL, 1396387111UL, 340137L},
+    {1372UL, 2868513436UL, 581130L},
+    {1284UL, 2128280566UL, 1054790L},
+    {1282UL, 370970870UL, 1162259L},
+    {1244UL, 626214166UL, 12765L},
+    {1221UL, 136029490UL, 565646L},
+    {1151UL, 2856619219UL, 175645L},
+    {1150UL, 638039811UL, 16592L},
+    {1090UL, 1213328348UL, 65347L},
+    {1072UL, 161047975UL, 324653L},
+    {946UL, 814809830UL, 664791L},
+    {708UL, 3542918883UL, 1112395L},
+    {653UL, 660324070UL, 410508L},
+    {628UL, 124408878UL, 5134875L},
+    {607UL, 3713126686UL, 2762439L},
+    {559UL, 2295412223UL, 2717L},
+    {524UL, 1376016908UL, 1559999L},
+    {483UL, 1439588434UL, 5022L},
+    {471UL, 961776306UL, 963386L},
+    {467UL, 283679584UL, 756776L},
+    {434UL, 3773963824UL, 955647L},
+    {405UL, 4092505297UL, 42123L},
+    {399UL, 231045063UL, 2167182L},
+    {396UL, 4012528089UL, 1834792L},
+    {379UL, 1606378332UL, 295294L},
+    {310UL, 3987236378UL, 759493L},
+    {300UL, 3858042452UL, 115209L},
+    {294UL, 3991337798UL, 206615L},
+    {252UL, 1118996332UL, 1154518L},
+    {249UL, 3244200670UL, 1177741L},
+    {239UL, 1606378332UL, 714653L},
+    {224UL, 352719664UL, 439865L},
+    {223UL, 1943376034UL, 1361L},
+    {220UL, 1313812494UL, 352901L},
+    {217UL, 4198458058UL, 30968L},
+    {216UL, 3266074803UL, 1777185L},
+    {208UL, 3814294186UL, 359034L},
+    {202UL, 886584197UL, 250L},
+    {199UL, 653488383UL, 795483L},
+    {194UL, 1290571248UL, 2380181L},
+    {193UL, 626145798UL, 2364697L},
+    {187UL, 901622602UL, 834L},
+    {182UL, 2417086824UL, 413226L},
+    {173UL, 1052006983UL, 837606L},
+    {172UL, 3882650648UL, 1146773L},
+    {170UL, 2513469550UL, 28251L},
+    {169UL, 4018680383UL, 94703L},
+    {165UL, 973396969UL, 557905L},
+    {163UL, 2084874058UL, 588873L},
+    {158UL, 504471157UL, 282533L},
+    {147UL, 863342951UL, 311889L},
+    {143UL, 888634826UL, 184748L},
+    {139UL, 3681682681UL, 167903L},
+    {139UL, 2911988230UL, 4744878L},
+    {124UL, 939218657UL, 37101L},
+    {110UL, 1385586780UL, 2889580L},
+    {109UL, 3900423361UL, 406592L},
+    {104UL, 3436966122UL, 3917L},
+    {104UL, 996638134UL, 127141L},
+    {103UL, 465507949UL, 78113L}
+};
+
+CONST VSOP87FixedCoefficient L1UranusFixedCoefficients[] =
+{
+    {3751271292UL, 0UL, 0L},
+    {77229UL, 3583260653UL, 390000L},
+    {12228UL, 1170646588UL, 7742L},
+    {4629UL, 292839371UL, 57605L},
+    {4133UL, 1026851762UL, 332395L},
+    {3921UL, 902169464UL, 780000L},
+    {1950UL, 317721140UL, 20507L},
+    {1142UL, 2852996292UL, 397742L},
+    {964UL, 362357944UL, 15483L},
+    {617UL, 1084339607UL, 369493L},
+    {395UL, 3715860749UL, 16590L},
+    {384UL, 1364396325UL, 382258L},
+    {241UL, 2039758760UL, 447604L},
+    {225UL, 2828593118UL, 722392L},
+    {223UL, 2544913555UL, 1170002L},
+    {214UL, 3233947282UL, 374518L},
+    {177UL, 1765649069UL, 772260L},
+    {174UL, 1677469184UL, 49862L},
+    {159UL, 3813610670UL, 274788L},
+    {103UL, 1615264689UL, 12767L},
+    {95UL, 2872341384UL, 295294L},
+    {92UL, 194132545UL, 787744L},
+    {90UL, 3885385037UL, 65346L},
+    {86UL, 2051379342UL, 410508L},
+    {79UL, 1988491332UL, 5022L},
+    {78UL, 3821813511UL, 23223L},
+    {77UL, 3179945628UL, 183387L},
+    {76UL, 2011048981UL, 405486L},
+    {71UL, 1770434005UL, 324651L},
+    {61UL, 2835428601UL, 664791L},
+    {58UL, 2551065685UL, 340135L},
+    {51UL, 2862771512UL, 759493L},
+    {51UL, 4124632818UL, 584L},
+    {44UL, 2727425456UL, 94708L},
+    {44UL, 4210761993UL, 1054772L},
+    {41UL, 1804612399UL, 115204L},
+    {36UL, 4135570048UL, 366784L},
+    {35UL, 2768439496UL, 406576L},
+    {30UL, 2529191552UL, 352912L},
+    {24UL, 2419821049UL, 1834808L},
+    {22UL, 4039870674UL, 37080L},
+    {22UL, 3909993233UL, 28266L},
+    {19UL, 3363141208UL, 1162257L},
+    {18UL, 4033035191UL, 175648L},
+    {18UL, 2248929731UL, 42139L},
+    {18UL, 2276272316UL, 373408L},
+    {18UL, 3472511548UL, 198855L},
+    {15UL, 3841636771UL, 5134875L},
+    {15UL, 3759609016UL, 311868L},
+    {15UL, 3732266431UL, 837612L},
+    {15UL, 1134718335UL, 2335362L},
+    {15UL, 786100051UL, 2409522L},
+    {15UL, 3089715033UL, 439849L},
+    {13UL, 3786951601UL, 685276L},
+    {13UL, 4203926510UL, 1560020L},
+    {13UL, 3410990569UL, 714637L},
+    {13UL, 3923664525UL, 1982450L}
+};
+
+CONST VSOP87FixedCoefficient L2UranusFixedCoefficients[] =
+{
+    {53033UL, 0UL, 0L},
+    {2358UL, 1544925803UL, 390000L},
+    {769UL, 3093816453UL, 57607L},
+    {552UL, 2227055597UL, 332395L},
+    {542UL, 1555794583UL, 20506L},
+    {529UL, 3365191755UL, 7739L},
+    {258UL, 2523039422UL, 16590L},
+    {239UL, 4004325249UL, 779999L},
+    {182UL, 4250408839UL, 369491L},
+    {54UL, 984334036UL, 397762L},
+    {49UL, 4121898755UL, 295284L},
+    {45UL, 2672740286UL, 12777L},
+    {45UL, 553687875UL, 447620L},
+    {38UL, 1216746171UL, 274788L},
+    {37UL, 3048701155UL, 15489L},
+    {33UL, 587866147UL, 49857L},
+    {29UL, 3486182840UL, 382273L},
+    {24UL, 1442322660UL, 94708L},
+    {22UL, 4094555844UL, 722408L},
+    {22UL, 3294784746UL, 410488L},
+    {21UL, 1640556727UL, 406576L},
+    {21UL, 1483336700UL, 1169976L},
+    {17UL, 1736255774UL, 759488L},
+    {17UL, 2371971526UL, 65346L},
+    {12UL, 13671305UL, 115204L},
+    {11UL, 54685221UL, 664780L},
+    {10UL, 3527196718UL, 373408L},
+    {10UL, 3048701155UL, 324646L},
+    {9UL, 2911988230UL, 37080L},
+    {8UL, 3759609016UL, 352912L},
+    {7UL, 854456594UL, 28266L},
+    {6UL, 2296779254UL, 2335362L},
+    {6UL, 3725430622UL, 340135L},
+    {6UL, 3089715033UL, 787754L},
+    {6UL, 3916829042UL, 2409522L}
+};
+
+CONST VSOP87FixedCoefficient L3UranusFixedCoefficients[] =
+{
+    {121UL, 16405567UL, 390002L},
+    {68UL, 2816288857UL, 20496L},
+    {53UL, 1633721080UL, 57628L},
+    {46UL, 0UL, 0L},
+    {45UL, 1394473136UL, 16584L},
+    {44UL, 2023353242UL, 7718L},
+    {25UL, 3342634106UL, 332416L},
+    {21UL, 3110222134UL, 369496L},
+    {20UL, 1579035747UL, 779984L},
+    {9UL, 1080033165UL, 295284L},
+    {4UL, 157220016UL, 94708L},
+    {4UL, 3684416744UL, 397762L},
+    {4UL, 649387004UL, 406576L},
+    {3UL, 3404155085UL, 447620L},
+    {3UL, 2823124666UL, 274788L},
+    {3UL, 252919155UL, 410488L},
+    {2UL, 587866147UL, 759488L},
+    {2UL, 3868979355UL, 49857L}
+};
+
+CONST VSOP87FixedCoefficient L4UranusFixedCoefficients[] =
+{
+    {114UL, 2147762068UL, 0L},
+    {6UL, 3130728910UL, 389992L},
+    {3UL, 239247842UL, 57628L},
+    {1UL, 2337793295UL, 295284L}
+};
+
+CONST VSOP87FixedCoefficient B0UranusFixedCoefficients[] =
+{
+    {1346278UL, 1790105699UL, 390000L},
+    {62341UL, 3473270358UL, 780000L},
+    {61601UL, 2147481915UL, 0L},
+    {9964UL, 1104641524UL, 397742L},
+    {9926UL, 393938685UL, 382258L},
+    {3259UL, 862112492UL, 1170001L},
+    {2972UL, 1533715428UL, 7742L},
+    {2010UL, 4139329547UL, 772258L},
+    {1522UL, 191124847UL, 332395L},
+    {924UL, 2760236656UL, 787744L},
+    {761UL, 4197090701UL, 374518L},
+    {522UL, 2270120348UL, 722392L},
+    {463UL, 507888980UL, 447604L},
+    {437UL, 2311134225UL, 2762439L},
+    {435UL, 233095753UL, 405486L},
+    {431UL, 2429390922UL, 1112395L},
+    {420UL, 3563425659UL, 57607L},
+    {245UL, 538649429UL, 15484L},
+    {233UL, 1542806806UL, 1162257L},
+    {216UL, 1087552327UL, 198871L},
+    {180UL, 2546280586UL, 1559999L},
+    {175UL, 844886641UL, 764515L},
+    {174UL, 1324065964UL, 1982439L},
+    {160UL, 3647504287UL, 581129L},
+    {144UL, 4075416100UL, 183387L},
+    {116UL, 3922981010UL, 369491L},
+    {106UL, 643234914UL, 366774L},
+    {102UL, 1790257428UL, 410508L}
+};
+
+CONST VSOP87FixedCoefficient B1UranusFixedCoefficients[] =
+{
+    {206366UL, 2818984132UL, 390000L},
+    {8563UL, 231181778UL, 780000L},
+    {1726UL, 1450457214UL, 382258L},
+    {1374UL, 0UL, 0L},
+    {1369UL, 2097588363UL, 397742L},
+    {451UL, 2581826012UL, 7739L},
+    {400UL, 1946793939UL, 1170002L},
+    {307UL, 857874418UL, 772260L},
+    {154UL, 2587978142UL, 332395L},
+    {112UL, 3809509249UL, 787744L},
+    {111UL, 3642719351UL, 722392L},
+    {83UL, 2453999281UL, 374503L},
+    {56UL, 2324122002UL, 447620L},
+    {54UL, 1162061001UL, 405481L},
+    {42UL, 827114010UL, 57628L},
+    {41UL, 3041865346UL, 410488L},
+    {32UL, 2577041076UL, 1162257L},
+    {30UL, 1749927066UL, 15489L},
+    {27UL, 3650238676UL, 1112400L},
+    {26UL, 287097407UL, 1982450L}
+};
+
+CONST VSOP87FixedCoefficient B2UranusFixedCoefficients[] =
+{
+    {9212UL, 3964951874UL, 390000L},
+    {557UL, 0UL, 0L},
+    {286UL, 1488121636UL, 779999L},
+    {95UL, 2624890600UL, 382273L},
+    {45UL, 3335798623UL, 397762L},
+    {20UL, 3732266431UL, 7718L},
+    {15UL, 601537439UL, 722408L},
+    {14UL, 1948160970UL, 772265L},
+    {14UL, 3465676065UL, 332416L},
+    {10UL, 3417826378UL, 1169976L},
+    {8UL, 4285954265UL, 410488L}
+};
+
+CONST VSOP87FixedCoefficient B3UranusFixedCoefficients[] =
+{
+    {268UL, 855140192UL, 390002L},
+    {11UL, 2146395037UL, 0L},
+    {6UL, 2741096912UL, 779984L},
+    {3UL, 3951007436UL, 382273L}
+};
+
+CONST VSOP87FixedCoefficient B4UranusFixedCoefficients[] =
+{
+    {6UL, 1948160970UL, 389992L}
+};
+
+CONST VSOP87FixedCoefficient R0UranusFixedCoefficients[] =
+{
+    {1921264770UL, 0UL, 0L},
+    {88784979UL, 3830546671UL, 390000L},
+    {3440836UL, 224456181UL, 382258L},
+    {2055653UL, 1218764042UL, 780000L},
+    {649322UL, 3091405406UL, 397742L},
+    {602248UL, 2638587968UL, 332395L},
+    {496404UL, 957947705UL, 2372438L},
+    {338526UL, 1080051581UL, 722395L},
+    {243508UL, 1073789442UL, 374517L},
+    {190522UL, 1365827650UL, 7742L},
+    {161858UL, 1908089738UL, 772259L},
+    {143706UL, 945839665UL, 57605L},
+    {93192UL, 119193281UL, 191129L},
+    {89806UL, 2502566708UL, 573388L},
+    {71424UL, 2901796121UL, 1170001L},
+    {46677UL, 956834180UL, 183387L},
+    {39026UL, 2298385695UL, 1444790L},
+    {39010UL, 1141355804UL, 369493L},
+    {36755UL, 2656669681UL, 764517L},
+    {30349UL, 479179241UL, 787742L},
+    {29156UL, 2174120449UL, 405484L},
+    {25786UL, 2587554245UL, 447606L},
+    {25620UL, 3593201782UL, 1982438L},
+    {22637UL, 495714691UL, 2762439L},
+    {20473UL, 1911521985UL, 366775L},
+    {20472UL, 1063552352UL, 1054790L},
+    {17901UL, 379071118UL, 15484L},
+    {15503UL, 3659842773UL, 198871L},
+    {14702UL, 3352436380UL, 565646L},
+    {12897UL, 1791993760UL, 581129L},
+    {12328UL, 4074315695UL, 664790L},
+    {11959UL, 1196540002UL, 5134877L},
+    {11853UL, 679074264UL, 274789L},
+    {11696UL, 2254575988UL, 20507L},
+    {11495UL, 299223862UL, 340137L},
+    {10793UL, 971380402UL, 1112395L},
+    {9111UL, 3415365460UL, 324653L},
+    {8421UL, 3591110165UL, 1162259L},
+    {8402UL, 3444348548UL, 2167185L},
+    {7449UL, 543366038UL, 1834790L},
+    {7329UL, 2715668138UL, 955646L},
+    {6046UL, 3882377176UL, 410507L},
+    {5524UL, 2129305840UL, 49863L},
+    {5445UL, 3490147688UL, 756775L},
+    {5238UL, 1797503282UL, 175645L},
+    {4079UL, 2201490251UL, 1777185L},
+    {3919UL, 2905288994UL, 206613L},
+    {3802UL, 4176515476UL, 963388L},
+    {3781UL, 2364042157UL, 2380180L},
+    {3687UL, 1700163568UL, 2364697L},
+    {3102UL, 2830165172UL, 1146775L},
+    {2963UL, 567222472UL, 295297L},
+    {2942UL, 289763326UL, 1560001L},
+    {2940UL, 1467204490UL, 714653L},
+    {2938UL, 2513196078UL, 730137L},
+    {2865UL, 211905237UL, 65347L},
+    {2538UL, 3318435954UL, 685296L},
+    {2364UL, 302477631UL, 2889580L},
+    {2183UL, 2009955258UL, 1592438L}
+};
+
+CONST VSOP87FixedCoefficient R1UranusFixedCoefficients[] =
+{
+    {1479896UL, 2510090596UL, 390000L},
+    {71212UL, 4255884136UL, 332395L},
+    {68627UL, 4193064575UL, 780000L},
+    {24060UL, 2147481915UL, 0L},
+    {21468UL, 1778479575UL, 397742L},
+    {20857UL, 3586154431UL, 57605L},
+    {11405UL, 12632286UL, 369493L},
+    {7497UL, 289558243UL, 382258L},
+    {4244UL, 968543665UL, 447606L},
+    {3927UL, 2156716874UL, 374517L},
+    {3578UL, 1580129470UL, 1170001L},
+    {3506UL, 1765990827UL, 722395L},
+    {3229UL, 3592135601UL, 20507L},
+    {3060UL, 104722201UL, 7742L},
+    {2564UL, 670440804UL, 772258L},
+    {2429UL, 2730433153UL, 274789L},
+    {1645UL, 1813840514UL, 664790L},
+    {1584UL, 977840148UL, 410507L},
+    {1508UL, 3458840255UL, 787742L},
+    {1490UL, 1828947287UL, 295297L},
+    {1413UL, 3127037860UL, 1054790L},
+    {1403UL, 936416063UL, 405484L},
+    {1228UL, 715692878UL, 324653L},
+    {1033UL, 180871378UL, 685296L},
+    {992UL, 1484703732UL, 340135L},
+    {862UL, 3455422351UL, 1834792L},
+    {744UL, 2102646771UL, 183387L},
+    {687UL, 1708229673UL, 406592L},
+    {647UL, 3057587512UL, 366774L},
+    {624UL, 589916816UL, 49862L},
+    {604UL, 619993709UL, 5134875L},
+    {575UL, 2208599369UL, 2335341L},
+    {562UL, 1857930375UL, 2409537L},
+    {530UL, 4044655610UL, 1112395L},
+    {528UL, 3521044750UL, 15484L}
+};
+
+CONST VSOP87FixedCoefficient R2UranusFixedCoefficients[] =
+{
+    {22440UL, 478174421UL, 390000L},
+    {4727UL, 1161377404UL, 332395L},
+    {1682UL, 3177416587UL, 369493L},
+    {1650UL, 2116728270UL, 57605L},
+    {1434UL, 2406970008UL, 780000L},
+    {770UL, 0UL, 0L},
+    {500UL, 4218964834UL, 397742L},
+    {461UL, 524294580UL, 20506L},
+    {390UL, 3073309351UL, 295294L},
+    {390UL, 3778065244UL, 447604L},
+    {292UL, 139447314UL, 274788L},
+    {287UL, 2415719629UL, 382258L},
+    {273UL, 2629675536UL, 722392L},
+    {220UL, 1342522192UL, 685297L},
+    {216UL, 579663347UL, 406592L},
+    {205UL, 2220219951UL, 410508L},
+    {149UL, 3348102558UL, 664791L},
+    {129UL, 1422499400UL, 16590L}
+};
+
+CONST VSOP87FixedCoefficient R3UranusFixedCoefficients[] =
+{
+    {1164UL, 3236339750UL, 390000L},
+    {212UL, 2285158672UL, 332395L},
+    {196UL, 2037024534UL, 369491L},
+    {105UL, 654855537UL, 57607L},
+    {73UL, 683565276UL, 779984L},
+    {72UL, 20506958UL, 295284L},
+    {55UL, 1770434005UL, 20496L},
+    {36UL, 3862143872UL, 406576L},
+    {34UL, 2611219307UL, 397762L},
+    {32UL, 2460834927UL, 685276L}
+};
+
+CONST VSOP87FixedCoefficient R4UranusFixedCoefficients[] =
+{
+    {53UL, 2057531473UL, 389992L},
+    {10UL, 1305609654UL, 295284L}
+};
+
+////////////////////////////////////////////////////////////
+//
+//         Fixed point tables of VSOP87 terms for Neptune.
+//
+
+CONST VSOP87FixedCoefficient L0NeptuneFixedCoefficients[] =
+{
+    {531188607UL, 0UL, 0L},
+    {1798476UL, 1983031681UL, 198871L},
+    {1019728UL, 332082162UL, 7742L},
+    {124532UL, 3301675640UL, 191129L},
+    {42064UL, 3698464182UL, 15484L},
+    {37715UL, 4164429927UL, 183387L},
+    {33785UL, 850963559UL, 397742L},
+    {16483UL, 54685UL, 2563568L},
+    {9199UL, 3375103548UL, 206613L},
+    {8994UL, 187707024UL, 913524L},
+    {4216UL, 1358312563UL, 382258L},
+    {3365UL, 708105267UL, 175645L},
+    {2285UL, 2875143897UL, 23225L},
+    {1434UL, 1902635628UL, 390000L},
+    {900UL, 1419081495UL, 573389L},
+    {745UL, 2180573268UL, 374518L},
+    {506UL, 3929133303UL, 596612L},
+    {400UL, 239247842UL, 5326007L},
+    {345UL, 2366502911UL, 214355L},
+    {340UL, 2258499603UL, 405486L},
+    {323UL, 1536654676UL, 167903L},
+    {306UL, 339731948UL, 2717L},
+    {287UL, 3079461645UL, 250L},
+    {282UL, 1535287644UL, 764515L},
+    {267UL, 3341950591UL, 5022L},
+    {252UL, 3952374468UL, 2025918L},
+    {245UL, 852405884UL, 49862L},
+    {233UL, 1712331094UL, 714653L},
+    {227UL, 1228366835UL, 2364697L},
+    {170UL, 2272170895UL, 565645L},
+    {151UL, 1498375024UL, 177004L},
+    {150UL, 2048645117UL, 30968L},
+    {148UL, 587182590UL, 581129L},
+    {119UL, 2513469550UL, 12767L},
+    {109UL, 1651493630UL, 955647L},
+    {103UL, 28026177UL, 1361L},
+    {103UL, 3010421341UL, 366774L},
+    {102UL, 3899739845UL, 584L}
+};
+
+CONST VSOP87FixedCoefficient L1NeptuneFixedCoefficients[] =
+{
+    {3837687797UL, 0UL, 0L},
+    {16604UL, 3324307932UL, 7742L},
+    {15807UL, 1558002564UL, 198871L},
+    {3335UL, 2516887291UL, 397742L},
+    {1306UL, 2510871896UL, 15483L},
+    {605UL, 1028765736UL, 183387L},
+    {179UL, 2360350944UL, 206615L},
+    {107UL, 1675418473UL, 23223L},
+    {106UL, 1883222412UL, 175648L},
+    {73UL, 3752773206UL, 191137L},
+    {57UL, 1271431422UL, 596618L},
+    {57UL, 3568210595UL, 2712L},
+    {35UL, 3089715033UL, 389992L},
+    {32UL, 4033035191UL, 405481L},
+    {30UL, 2508684614UL, 2025945L},
+    {29UL, 3534032527UL, 49857L},
+    {29UL, 3534032527UL, 12777L},
+    {26UL, 3588717697UL, 876413L}
+};
+
+CONST VSOP87FixedCoefficient L2NeptuneFixedCoefficients[] =
+{
+    {53893UL, 0UL, 0L},
+    {296UL, 1268013599UL, 7739L},
+    {281UL, 814126233UL, 198871L},
+    {270UL, 3910677075UL, 397742L},
+    {23UL, 827114010UL, 15489L},
+    {9UL, 3028194053UL, 183366L},
+    {7UL, 369125263UL, 12777L}
+};
+
+CONST VSOP87FixedCoefficient L3NeptuneFixedCoefficients[] =
+{
+    {31UL, 0UL, 0L},
+    {15UL, 922813138UL, 397762L},
+    {12UL, 4128734238UL, 7718L},
+    {12UL, 4176583925UL, 198855L}
+};
+
+CONST VSOP87FixedCoefficient L4NeptuneFixedCoefficients[] =
+{
+    {114UL, 2147762068UL, 0L}
+};
+
+CONST VSOP87FixedCoefficient B0NeptuneFixedCoefficients[] =
+{
+    {3088623UL, 985047621UL, 198871L},
+    {27780UL, 4041730215UL, 397742L},
+    {27624UL, 0UL, 0L},
+    {15448UL, 2398473324UL, 206613L},
+    {15355UL, 1723432113UL, 191129L},
+    {2000UL, 1032183560UL, 390000L},
+    {1968UL, 2992512055UL, 7742L},
+    {1015UL, 2198072510UL, 183387L},
+    {606UL, 1915349933UL, 382258L},
+    {595UL, 1455310436UL, 214355L},
+    {589UL, 2178522558UL, 15484L},
+    {402UL, 2849783736UL, 596612L},
+    {280UL, 1149756822UL, 405486L},
+    {262UL, 2574990366UL, 1112395L},
+    {254UL, 2235941954UL, 2364697L},
+    {206UL, 2909937357UL, 2762439L},
+    {140UL, 2412985403UL, 714653L}
+};
+
+CONST VSOP87FixedCoefficient B1NeptuneFixedCoefficients[] =
+{
+    {227279UL, 2602969367UL, 198871L},
+    {1803UL, 1350588297UL, 397742L},
+    {1433UL, 2147488597UL, 0L},
+    {1386UL, 3298612694UL, 191129L},
+    {1073UL, 4156418744UL, 206613L},
+    {148UL, 2637194861UL, 390002L},
+    {136UL, 326744192UL, 7739L},
+    {70UL, 4231269095UL, 183366L},
+    {52UL, 3452004772UL, 382273L},
+    {43UL, 211905237UL, 596618L},
+    {37UL, 3342634106UL, 214344L},
+    {37UL, 3937336144UL, 15489L},
+    {26UL, 3568210595UL, 1112400L}
+};
+
+CONST VSOP87FixedCoefficient B2NeptuneFixedCoefficients[] =
+{
+    {9691UL, 3808278791UL, 198871L},
+    {79UL, 2481342029UL, 397762L},
+    {72UL, 307604366UL, 191137L},
+    {59UL, 2146395037UL, 0L},
+    {30UL, 1100540103UL, 206626L},
+    {6UL, 3834801287UL, 389992L}
+};
+
+CONST VSOP87FixedCoefficient B3NeptuneFixedCoefficients[] =
+{
+    {273UL, 695185858UL, 198871L},
+    {2UL, 0UL, 0L},
+    {2UL, 1620049625UL, 191137L},
+    {2UL, 3643402867UL, 397762L}
+};
+
+CONST VSOP87FixedCoefficient B4NeptuneFixedCoefficients[] =
+{
+    {6UL, 1825119338UL, 198855L}
+};
+
+CONST VSOP87FixedCoefficient R0NeptuneFixedCoefficients[] =
+{
+    {3007013029UL, 0UL, 0L},
+    {27062257UL, 909138423UL, 198871L},
+    {1691764UL, 2222859326UL, 191129L},
+    {807831UL, 3544920212UL, 7742L},
+    {537761UL, 3090493726UL, 183387L},
+    {495726UL, 1073919985UL, 2563568L},
+    {274572UL, 1261535438UL, 913524L},
+    {135134UL, 2305122905UL, 206613L},
+    {121802UL, 3962999764UL, 397742L},
+    {100895UL, 257722569UL, 382258L},
+    {69792UL, 2594929990UL, 15484L},
+    {46688UL, 3930076600UL, 175646L},
+    {24594UL, 347264820UL, 573388L},
+    {16939UL, 1089753462UL, 374517L},
+    {14230UL, 736787666UL, 390000L},
+    {12012UL, 1312869115UL, 5326006L},
+    {8395UL, 463593974UL, 764517L},
+    {7572UL, 732440154UL, 2025920L},
+    {5721UL, 1770844212UL, 23225L},
+    {4840UL, 1303490657UL, 214355L},
+    {4483UL, 1986235600UL, 2762439L},
+    {4421UL, 1196170864UL, 565646L},
+    {4354UL, 464756024UL, 167904L},
+    {4270UL, 2333281667UL, 2364697L},
+    {3381UL, 579731715UL, 955646L},
+    {2881UL, 1357560598UL, 714653L},
+    {2879UL, 2511555575UL, 1827048L},
+    {2636UL, 2117411786UL, 1112395L},
+    {2530UL, 3963584843UL, 2555826L},
+    {2523UL, 332417788UL, 2571309L},
+    {2306UL, 1920545077UL, 366775L},
+    {2087UL, 422853487UL, 177005L}
+};
+
+CONST VSOP87FixedCoefficient R1NeptuneFixedCoefficients[] =
+{
+    {236339UL, 481899859UL, 198871L},
+    {13220UL, 2269539180UL, 7742L},
+    {8622UL, 4249246830UL, 183387L},
+    {2702UL, 1286059702UL, 206613L},
+    {2155UL, 1431590778UL, 15483L},
+    {2153UL, 3533143989UL, 397742L},
+    {1603UL, 0UL, 0L},
+    {1464UL, 809478032UL, 175645L},
+    {1136UL, 2678823967UL, 191129L},
+    {898UL, 3582565729UL, 2025918L},
+    {790UL, 364340287UL, 876428L},
+    {760UL, 14354871UL, 950625L},
+    {607UL, 736199817UL, 5326007L},
+    {572UL, 2324805518UL, 2526467L},
+    {561UL, 1973453008UL, 2600664L}
+};
+
+CONST VSOP87FixedCoefficient R2NeptuneFixedCoefficients[] =
+{
+    {4247UL, 4032419799UL, 198871L},
+    {218UL, 236513576UL, 7739L},
+    {163UL, 1530502708UL, 876428L},
+    {156UL, 3140298782UL, 950625L},
+    {127UL, 1946793939UL, 183387L}
+};
+
+CONST VSOP87FixedCoefficient R3NeptuneFixedCoefficients[] =
+{
+    {166UL, 3111589166UL, 198871L}
+};
+
+#if ARDUINO
+#define VSOP87_FIXED_DESCRIPTOR const PROGMEM
+#else
+#define VSOP87_FIXED_DESCRIPTOR const
+#endif
+
+#define VSOP87_FIXED_SERIES(table, shift) {table, sizeof(table)/sizeof(VSOP87FixedCoefficient), shift}
+#define VSOP87_FIXED_NO_SERIES           {NULL, 0, 0}
+
+static VSOP87_FIXED_DESCRIPTOR VSOP87FixedPlanetSeries vsop87FixedPlanetSeries[] =
+{
+    // Sun
+    {{
+        {VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES}
+    }},
+    // Mercury
+    {{
+        {VSOP87_FIXED_SERIES(L0MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1MercuryFixedCoefficients, 10), VSOP87_FIXED_SERIES(L2MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5MercuryFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4MercuryFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2MercuryFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3MercuryFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES}
+    }},
+    // Venus
+    {{
+        {VSOP87_FIXED_SERIES(L0VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1VenusFixedCoefficients, 8), VSOP87_FIXED_SERIES(L2VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5VenusFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4VenusFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3VenusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R4VenusFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES}
+    }},
+    // Earth
+    {{
+        {VSOP87_FIXED_SERIES(L0EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1EarthFixedCoefficients, 8), VSOP87_FIXED_SERIES(L2EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5EarthFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1EarthFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2EarthFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3EarthFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES}
+    }},
+    // Mars
+    {{
+        {VSOP87_FIXED_SERIES(L0MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1MarsFixedCoefficients, 7), VSOP87_FIXED_SERIES(L2MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5MarsFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4MarsFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3MarsFixedCoefficients, 0), VSOP87_FIXED_SERIES(R4MarsFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES}
+    }},
+    // Jupiter
+    {{
+        {VSOP87_FIXED_SERIES(L0JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1JupiterFixedCoefficients, 4), VSOP87_FIXED_SERIES(L2JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5JupiterFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(B5JupiterFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(R0JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(R4JupiterFixedCoefficients, 0), VSOP87_FIXED_SERIES(R5JupiterFixedCoefficients, 0)}
+    }},
+    // Saturn
+    {{
+        {VSOP87_FIXED_SERIES(L0SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1SaturnFixedCoefficients, 3), VSOP87_FIXED_SERIES(L2SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(L5SaturnFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(B0SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(B5SaturnFixedCoefficients, 0)},
+        {VSOP87_FIXED_SERIES(R0SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(R4SaturnFixedCoefficients, 0), VSOP87_FIXED_SERIES(R5SaturnFixedCoefficients, 0)}
+    }},
+    // Uranus
+    {{
+        {VSOP87_FIXED_SERIES(L0UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1UranusFixedCoefficients, 1), VSOP87_FIXED_SERIES(L2UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4UranusFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(B0UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4UranusFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3UranusFixedCoefficients, 0), VSOP87_FIXED_SERIES(R4UranusFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES}
+    }},
+    // Neptune
+    {{
+        {VSOP87_FIXED_SERIES(L0NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(L1NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(L2NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(L3NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(L4NeptuneFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(B0NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(B1NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(B2NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(B3NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(B4NeptuneFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES},
+        {VSOP87_FIXED_SERIES(R0NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(R1NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(R2NeptuneFixedCoefficients, 0), VSOP87_FIXED_SERIES(R3NeptuneFixedCoefficients, 0), VSOP87_FIXED_NO_SERIES, VSOP87_FIXED_NO_SERIES}
+    }}
+};
+
+#endif
@@ -0,0 +1,168 @@
+/*
+ * VSOP87FixedPoint.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+#include <math.h>
+#include <string.h>
+
+#include "VSOP87FixedPoint.hpp"
+#include "VSOP87Fixed.h"
+
+
+#ifndef PI
+#define PI 3.1415926535
+#endif
+
+// One turn in 1e-8 radian with 20 more fractional bits (longitude reduction)
+#define FIXED_TURN 658839731666114LL
+
+// Fractional bits of the sine table interval
+#define FIXED_SINE_FRACTION_BITS (30-VSOP87_FIXED_SINE_BITS)
+
+// Product of a 64 bits value (|value| < 2^62) by a Q31 factor
+static inline int64_t multiplyQ31(int64_t value, int32_t factor)
+{
+    // Halves of 32 bits: both products fit 64 bits
+    int32_t  high = (int32_t)(value >> 32);
+    uint32_t low  = (uint32_t)value;
+    
+    return (int64_t)high*factor*2 + (((int64_t)(low >> 1)*factor) >> 30);
+}
+
+int32_t VSOP87FixedPoint::cosine(uint32_t phase)
+{
+    // cos(x) = sin(x + quarter turn)
+    phase += 0x40000000UL;
+    
+    uint32_t quadrant = phase >> 30;
+    uint32_t offset   = phase & 0x3FFFFFFFUL;
+    
+    // Second and fourth quarters mirror the table
+    if( quadrant & 1 )
+    {
+        offset = 0x40000000UL - offset;
+    }
+    
+    unsigned int index    = (unsigned int)(offset >> FIXED_SINE_FRACTION_BITS);
+    uint32_t     fraction = offset & ((1UL << FIXED_SINE_FRACTION_BITS) - 1);
+    
+#if ARDUINO
+    int32_t first  = (int32_t)pgm_read_dword(&VSOP87FixedSine[index]);
+    int32_t second = (int32_t)pgm_read_dword(&VSOP87FixedSine[index+1]);
+#else
+    int32_t first  = VSOP87FixedSine[index];
+    int32_t second = VSOP87FixedSine[index+1];
+#endif
+    
+    int32_t value = first + (int32_t)(((int64_t)(second-first)*fraction) >> FIXED_SINE_FRACTION_BITS);
+    
+    return quadrant & 2 ? -value : value;
+}
+
+int64_t VSOP87FixedPoint::sumSeries(const VSOP87FixedCoefficient *coefficients, int termCount, int32_t tau)
+{
+    int64_t sum = 0;
+    
+    for(int numCoef=0; numCoef<termCount; numCoef++)
+    {
+        VSOP87FixedCoefficient coef;
+        
+#if ARDUINO
+        memcpy_P(&coef, &coefficients[numCoef], sizeof(VSOP87FixedCoefficient));
+#else
+        coef = coefficients[numCoef];
+#endif
+        
+        // B + C*t in Q32 turns: integer overflow is the reduction to one turn
+        uint32_t phase = coef.B + (uint32_t)(((int64_t)coef.C*tau) >> (VSOP87_FIXED_FREQUENCY_BITS+31-32));
+        
+        sum += ((int64_t)coef.A*cosine(phase)) >> 30;
+    }
+    
+    return sum;
+}
+
+HeliocentricCoordinates VSOP87FixedPoint::heliocentricCoordinatesForPlanetAndT(SolarSystemObjectIndex planet, float T,
+                                                                               const VSOP87Truncation *truncation)
+{
+    HeliocentricCoordinates coordinates;
+    
+    if( planet < Sun || planet > Neptune )
+    {
+        coordinates.lon    = NAN;
+        coordinates.lat    = NAN;
+        coordinates.radius = NAN;
+        return coordinates;
+    }
+    
+    // VSOP87 time unit is thousand of Julian years (Q31 limits time to years 1000 to 3000)
+    T = T > 9.999999 ? 9.999999 : (T < -9.999999 ? -9.999999 : T);
+    
+    // T in Q27 is exact (power of two scale), then tau = T*1.6 in Q31 without rounding T/10 in single precision
+    int32_t fixedT   = (int32_t)floor(T*134217728.0+0.5);
+    int32_t fixedTau = (int32_t)(((int64_t)fixedT*3435973837LL + (1LL << 30)) >> 31);
+    
+    VSOP87FixedPlanetSeries planetSeries;
+#if ARDUINO
+    memcpy_P(&planetSeries, &vsop87FixedPlanetSeries[planet], sizeof(VSOP87FixedPlanetSeries));
+#else
+    planetSeries = vsop87FixedPlanetSeries[planet];
+#endif
+    
+    // Sum of tables multiplied by powers of time (Horner scheme)
+    int64_t values[VSOP87_VARIABLE_COUNT];
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        int64_t value = 0;
+        
+        for(int power=VSOP87_POWER_COUNT-1; power>=0; power--)
+        {
+            value = multiplyQ31(value, fixedTau);
+            
+            const VSOP87FixedSeries *series = &planetSeries.series[variable][power];
+            if( series->count == 0 )
+            {
+                continue;
+            }
+            
+            int termCount = truncation ? truncation->count[planet][variable][power] : series->count;
+            if( termCount > series->count )
+            {
+                termCount = series->count;
+            }
+            
+            value += sumSeries(series->coefficients, termCount, fixedTau)*((int64_t)1 << series->shift);
+        }
+        
+        values[variable] = value;
+    }
+    
+    // Longitude reduced to one turn before single precision
+    int64_t lon = values[0]*((int64_t)1 << 20) % FIXED_TURN;
+    lon = lon < 0 ? lon+FIXED_TURN : lon;
+    
+    coordinates.lon    = (float)lon*(float)(360.0/FIXED_TURN);
+    coordinates.lat    = (float)values[1]*(float)(180.0/PI/100000000.0);
+    coordinates.radius = (float)values[2]/100000000.0;
+    
+    return coordinates;
+}
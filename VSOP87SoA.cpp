@@ -0,0 +1,424 @@
+/*
+ * VSOP87SoA.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "VSOP87SoA.hpp"
+#include "FastMath.hpp"
+#include "ELP2000Moon.h"
+
+#if EPHEMERIS_USE_SOA
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Tables are built once by the first thread needing them, then read without lock
+#if __cplusplus >= 201103L
+#define VSOP87_SOA_THREAD_SAFE 1
+#include <atomic>
+#include <mutex>
+#else
+#define VSOP87_SOA_THREAD_SAFE 0
+#endif
+
+// Alignment of SoA arrays (cache line, also enough for AVX-512 loads)
+#define VSOP87_SOA_ALIGNMENT 64
+
+// Number of cached series (VSOP87.h holds 124 tables)
+#define VSOP87_SOA_CACHE_SIZE 256
+
+#if defined(__GNUC__)
+// One register of lanes (GCC/Clang vector extensions: AVX2, AVX-512, NEON...)
+typedef float SoAFloats __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(float))));
+typedef int   SoAInts   __attribute__((vector_size(VSOP87_SOA_LANES*sizeof(int))));
+
+static inline SoAFloats soaLoad(const float *values)
+{
+    SoAFloats vector;
+    memcpy(&vector, values, sizeof(vector));
+    return vector;
+}
+
+static inline void soaStore(float *values, SoAFloats vector)
+{
+    memcpy(values, &vector, sizeof(vector));
+}
+#endif
+
+#if VSOP87_SOA_THREAD_SAFE
+struct VSOP87SoACacheEntry
+{
+    // Published once series is built (release), read with acquire
+    std::atomic<const VSOP87Coefficient *> coefficients;
+    VSOP87SeriesSoA                        series;
+};
+
+// Serializes table builds only
+static std::mutex soaCacheLock;
+#else
+struct VSOP87SoACacheEntry
+{
+    const VSOP87Coefficient *coefficients;
+    VSOP87SeriesSoA          series;
+};
+#endif
+
+static VSOP87SoACacheEntry soaCache[VSOP87_SOA_CACHE_SIZE];
+
+bool VSOP87SoA::buildSeries(const VSOP87Coefficient *coefficients, int coefCount, VSOP87SeriesSoA *series)
+{
+    int paddedCount = (coefCount+VSOP87_SOA_LANES-1)/VSOP87_SOA_LANES*VSOP87_SOA_LANES;
+    
+    // One block for the three arrays (never released: tables live as long as the program)
+    size_t arraySize = (paddedCount*sizeof(float)+VSOP87_SOA_ALIGNMENT-1)/VSOP87_SOA_ALIGNMENT*VSOP87_SOA_ALIGNMENT;
+    char  *block     = (char *)malloc(3*arraySize+VSOP87_SOA_ALIGNMENT);
+    if( block == NULL )
+    {
+        return false;
+    }
+    
+    uintptr_t aligned = ((uintptr_t)block+VSOP87_SOA_ALIGNMENT-1) & ~(uintptr_t)(VSOP87_SOA_ALIGNMENT-1);
+    float *A = (float *)aligned;
+    float *B = (float *)(aligned+arraySize);
+    float *C = (float *)(aligned+2*arraySize);
+    
+    for(int numCoef=0; numCoef<paddedCount; numCoef++)
+    {
+        if( numCoef<coefCount )
+        {
+            // sqrt(A) is stored in VSOP87.h, square it back once for all.
+            A[numCoef] = coefficients[numCoef].A*coefficients[numCoef].A;
+            B[numCoef] = coefficients[numCoef].B;
+            C[numCoef] = coefficients[numCoef].C;
+        }
+        else
+        {
+            // Null padding term
+            A[numCoef] = 0;
+            B[numCoef] = 0;
+            C[numCoef] = 0;
+        }
+    }
+    
+    series->A           = A;
+    series->B           = B;
+    series->C           = C;
+    series->count       = coefCount;
+    series->paddedCount = paddedCount;
+    
+    return true;
+}
+
+const VSOP87SeriesSoA *VSOP87SoA::seriesForCoefficients(const VSOP87Coefficient *coefficients, int coefCount)
+{
+    // Open addressing on table address
+    unsigned int slot = (unsigned int)(((uintptr_t)coefficients/sizeof(VSOP87Coefficient)) % VSOP87_SOA_CACHE_SIZE);
+    
+    for(int probe=0; probe<VSOP87_SOA_CACHE_SIZE; probe++)
+    {
+        VSOP87SoACacheEntry *entry = &soaCache[slot];
+        
+#if VSOP87_SOA_THREAD_SAFE
+        const VSOP87Coefficient *entryCoefficients = entry->coefficients.load(std::memory_order_acquire);
+#else
+        const VSOP87Coefficient *entryCoefficients = entry->coefficients;
+#endif
+        
+        if( entryCoefficients == coefficients )
+        {
+            return &entry->series;
+        }
+        
+        if( entryCoefficients == NULL )
+        {
+#if VSOP87_SOA_THREAD_SAFE
+            std::lock_guard<std::mutex> guard(soaCacheLock);
+            
+            // Slot may have been taken meanwhile (by this table or another one)
+            entryCoefficients = entry->coefficients.load(std::memory_order_relaxed);
+            if( entryCoefficients == coefficients )
+            {
+                return &entry->series;
+            }
+            
+            if( entryCoefficients == NULL )
+            {
+                // First use of this table
+                if( !buildSeries(coefficients, coefCount, &entry->series) )
+                {
+                    return NULL;
+                }
+                entry->coefficients.store(coefficients, std::memory_order_release);
+                
+                return &entry->series;
+            }
+#else
+            // First use of this table
+            if( !buildSeries(coefficients, coefCount, &entry->series) )
+            {
+                return NULL;
+            }
+            entry->coefficients = coefficients;
+            
+            return &entry->series;
+#endif
+        }
+        
+        slot = (slot+1) % VSOP87_SOA_CACHE_SIZE;
+    }
+    
+    // Cache is full
+    return NULL;
+}
+
+float VSOP87SoA::sumSeries(const VSOP87SeriesSoA *series, int termCount, float T)
+{
+    const float *A = series->A;
+    const float *B = series->B;
+    const float *C = series->C;
+    
+#if defined(__GNUC__)
+    // One partial sum per lane, reduced at the end
+    SoAFloats lanes = {0};
+    
+    for(int block=0; block<termCount; block+=VSOP87_SOA_LANES)
+    {
+        SoAFloats a = *(const SoAFloats *)(A+block);
+        SoAFloats b = *(const SoAFloats *)(B+block);
+        SoAFloats c = *(const SoAFloats *)(C+block);
+        
+        lanes += a*fastCos<SoAFloats,SoAInts>(b + c*T);
+    }
+#else
+    float lanes[VSOP87_SOA_LANES] = {0};
+    
+    for(int block=0; block<termCount; block+=VSOP87_SOA_LANES)
+    {
+        for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+        {
+            lanes[lane] += A[block+lane]*fastCos<float,int>(B[block+lane] + C[block+lane]*T);
+        }
+    }
+#endif
+    
+    float value = 0;
+    for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+    {
+        value += lanes[lane];
+    }
+    
+    return value;
+}
+
+float VSOP87SoA::sumSeriesAndRate(const VSOP87SeriesSoA *series, int termCount, float T, float *rate)
+{
+    const float *A = series->A;
+    const float *B = series->B;
+    const float *C = series->C;
+    
+#if defined(__GNUC__)
+    SoAFloats lanes     = {0};
+    SoAFloats rateLanes = {0};
+    
+    for(int block=0; block<termCount; block+=VSOP87_SOA_LANES)
+    {
+        SoAFloats a = *(const SoAFloats *)(A+block);
+        SoAFloats b = *(const SoAFloats *)(B+block);
+        SoAFloats c = *(const SoAFloats *)(C+block);
+        
+        SoAFloats sine, cosine;
+        fastSinCos<SoAFloats,SoAInts>(b + c*T, &sine, &cosine);
+        
+        lanes     += a*cosine;
+        rateLanes -= a*c*sine;
+    }
+#else
+    float lanes[VSOP87_SOA_LANES]     = {0};
+    float rateLanes[VSOP87_SOA_LANES] = {0};
+    
+    for(int block=0; block<termCount; block+=VSOP87_SOA_LANES)
+    {
+        for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+        {
+            float sine, cosine;
+            fastSinCos<float,int>(B[block+lane] + C[block+lane]*T, &sine, &cosine);
+            
+            lanes[lane]     += A[block+lane]*cosine;
+            rateLanes[lane] -= A[block+lane]*C[block+lane]*sine;
+        }
+    }
+#endif
+    
+    float value     = 0;
+    float valueRate = 0;
+    for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+    {
+        value     += lanes[lane];
+        valueRate += rateLanes[lane];
+    }
+    
+    *rate = valueRate;
+    
+    return value;
+}
+
+void VSOP87SoA::addSeriesForTimes(const VSOP87SeriesSoA *series, int termCount, const float *T, float *sums, int count)
+{
+    for(int term=0; term<termCount; term++)
+    {
+        float A = series->A[term];
+        float B = series->B[term];
+        float C = series->C[term];
+        
+#if defined(__GNUC__)
+        for(int epoch=0; epoch<count; epoch+=VSOP87_SOA_LANES)
+        {
+            SoAFloats value = soaLoad(sums+epoch);
+            value += A*fastCos<SoAFloats,SoAInts>(B + C*soaLoad(T+epoch));
+            soaStore(sums+epoch, value);
+        }
+#else
+        for(int epoch=0; epoch<count; epoch++)
+        {
+            sums[epoch] += A*fastCos<float,int>(B + C*T[epoch]);
+        }
+#endif
+    }
+}
+
+// Terms of the Moon padded to a multiple of lanes
+#define MOON_SOA_COUNT ((MOON_TERM_COUNT+VSOP87_SOA_LANES-1)/VSOP87_SOA_LANES*VSOP87_SOA_LANES)
+
+/*! This structure describes storage of one table of the Moon. */
+struct MoonSeriesStorage
+{
+    float D[MOON_SOA_COUNT];
+    float M[MOON_SOA_COUNT];
+    float Mm[MOON_SOA_COUNT];
+    float F[MOON_SOA_COUNT];
+    float sine[MOON_SOA_COUNT];
+    float cosine[MOON_SOA_COUNT];
+    
+    MoonSeriesSoA series;
+};
+
+// Fill structure of arrays from a table of ELP2000Moon.h
+static const MoonSeriesSoA *buildMoonSeries(const MoonTerm *terms, MoonSeriesStorage *storage)
+{
+    for(int numTerm=0; numTerm<MOON_SOA_COUNT; numTerm++)
+    {
+        // Null padding term
+        MoonTerm term = {0, 0, 0, 0, 0, 0};
+        if( numTerm < MOON_TERM_COUNT )
+        {
+            term = terms[numTerm];
+        }
+        
+        storage->D[numTerm]      = term.D;
+        storage->M[numTerm]      = term.M;
+        storage->Mm[numTerm]     = term.Mm;
+        storage->F[numTerm]      = term.F;
+        storage->sine[numTerm]   = term.sine;
+        storage->cosine[numTerm] = term.cosine;
+    }
+    
+    storage->series.D           = storage->D;
+    storage->series.M           = storage->M;
+    storage->series.Mm          = storage->Mm;
+    storage->series.F           = storage->F;
+    storage->series.sine        = storage->sine;
+    storage->series.cosine      = storage->cosine;
+    storage->series.paddedCount = MOON_SOA_COUNT;
+    
+    return &storage->series;
+}
+
+const MoonSeriesSoA *VSOP87SoA::moonSeries(bool latitude)
+{
+    static MoonSeriesStorage longitudeDistanceStorage;
+    static MoonSeriesStorage latitudeStorage;
+    
+    // Built once (initialization of local statics is thread safe in C++11)
+    static const MoonSeriesSoA *longitudeDistance = buildMoonSeries(MoonLongitudeDistanceTerms, &longitudeDistanceStorage);
+    static const MoonSeriesSoA *latitudeSeries    = buildMoonSeries(MoonLatitudeTerms, &latitudeStorage);
+    
+    return latitude ? latitudeSeries : longitudeDistance;
+}
+
+void VSOP87SoA::sumMoonSeries(const MoonSeriesSoA *series, const float arguments[4], float E, float *sineSum, float *cosineSum)
+{
+    float E2 = E*E;
+    
+#if defined(__GNUC__)
+    SoAFloats sineLanes   = {0};
+    SoAFloats cosineLanes = {0};
+    
+    for(int block=0; block<series->paddedCount; block+=VSOP87_SOA_LANES)
+    {
+        SoAFloats M = soaLoad(series->M+block);
+        
+        SoAFloats argument = soaLoad(series->D+block)*arguments[0] + M*arguments[1]
+                           + soaLoad(series->Mm+block)*arguments[2] + soaLoad(series->F+block)*arguments[3];
+        
+        // Terms with M decrease with eccentricity of Earth orbit
+        SoAFloats absM   = M < 0 ? -M : M;
+        SoAFloats factor = absM > 1.5f ? E2 : (absM > 0.5f ? E : 1.0f);
+        
+        SoAFloats sine, cosine;
+        fastSinCosDegrees<SoAFloats,SoAInts>(argument, &sine, &cosine);
+        
+        sineLanes   += factor*soaLoad(series->sine+block)*sine;
+        cosineLanes += factor*soaLoad(series->cosine+block)*cosine;
+    }
+#else
+    float sineLanes[VSOP87_SOA_LANES]   = {0};
+    float cosineLanes[VSOP87_SOA_LANES] = {0};
+    
+    for(int block=0; block<series->paddedCount; block+=VSOP87_SOA_LANES)
+    {
+        for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+        {
+            int   numTerm = block+lane;
+            float M       = series->M[numTerm];
+            
+            float argument = series->D[numTerm]*arguments[0] + M*arguments[1]
+                           + series->Mm[numTerm]*arguments[2] + series->F[numTerm]*arguments[3];
+            
+            float absM   = M < 0 ? -M : M;
+            float factor = absM > 1.5f ? E2 : (absM > 0.5f ? E : 1.0f);
+            
+            float sine, cosine;
+            fastSinCosDegrees<float,int>(argument, &sine, &cosine);
+            
+            sineLanes[lane]   += factor*series->sine[numTerm]*sine;
+            cosineLanes[lane] += factor*series->cosine[numTerm]*cosine;
+        }
+    }
+#endif
+    
+    *sineSum   = 0;
+    *cosineSum = 0;
+    for(int lane=0; lane<VSOP87_SOA_LANES; lane++)
+    {
+        *sineSum   += sineLanes[lane];
+        *cosineSum += cosineLanes[lane];
+    }
+}
+
+#endif
@@ -0,0 +1,124 @@
+/*
+ * VSOP87SoA.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VSOP87SoA_h
+#define VSOP87SoA_h
+
+#include "VSOP87.h"
+
+// Structure of arrays kernel is only worth it (and only affordable in SRAM) on PC.
+#ifndef EPHEMERIS_USE_SOA
+#if ARDUINO
+#define EPHEMERIS_USE_SOA 0
+#else
+#define EPHEMERIS_USE_SOA 1
+#endif
+#endif
+
+// Number of terms evaluated together (one vector register of floats: AVX-512, AVX2, SSE/NEON).
+#ifndef VSOP87_SOA_LANES
+#if defined(__AVX512F__)
+#define VSOP87_SOA_LANES 16
+#elif defined(__AVX__)
+#define VSOP87_SOA_LANES 8
+#else
+#define VSOP87_SOA_LANES 4
+#endif
+#endif
+
+// Number of epochs evaluated together by batch evaluation (multiple of VSOP87_SOA_LANES).
+#ifndef VSOP87_SOA_BATCH_EPOCHS
+#define VSOP87_SOA_BATCH_EPOCHS 64
+#endif
+
+/*! This structure describes a VSOP87 series stored as structure of arrays.
+ *  Arrays are aligned on 64 bytes and padded with null terms up to a multiple of VSOP87_SOA_LANES. */
+struct VSOP87SeriesSoA
+{
+    /*! Amplitudes (already squared back, unlike VSOP87.h). */
+    const float *A;
+    
+    /*! Phases. */
+    const float *B;
+    
+    /*! Frequencies. */
+    const float *C;
+    
+    /*! Number of terms of the original table. */
+    int count;
+    
+    /*! Number of stored terms (multiple of VSOP87_SOA_LANES). */
+    int paddedCount;
+};
+
+/*! This structure describes periodic terms of the Moon (ELP2000Moon.h) stored as structure of arrays.
+ *  Arrays are padded with null terms up to a multiple of VSOP87_SOA_LANES. */
+struct MoonSeriesSoA
+{
+    /*! Multiples of D, M, M' and F (as floats). */
+    const float *D;
+    const float *M;
+    const float *Mm;
+    const float *F;
+    
+    /*! Sine and cosine coefficients. */
+    const float *sine;
+    const float *cosine;
+    
+    /*! Number of stored terms (multiple of VSOP87_SOA_LANES). */
+    int paddedCount;
+};
+
+/*!
+ * This class evaluates VSOP87 series stored as structure of arrays, VSOP87_SOA_LANES terms at a time.
+ * Ephemeris::sumVSOP87Coefs remains the scalar reference implementation.
+ */
+class VSOP87SoA
+{
+public:
+    
+    /*! Get structure of arrays version of a compiled VSOP87 table (built on first use, safe from any thread in C++11).
+     *  Return NULL if memory is not available. */
+    static const VSOP87SeriesSoA *seriesForCoefficients(const VSOP87Coefficient *coefficients, int coefCount);
+    
+    /*! Build structure of arrays version of a compiled VSOP87 table into a new series. */
+    static bool buildSeries(const VSOP87Coefficient *coefficients, int coefCount, VSOP87SeriesSoA *series);
+    
+    /*! Compute VSOP87 series for T (thousands of Julian years from J2000).
+     *  Only first termCount terms are needed (rounded up to a whole block of lanes). */
+    static float sumSeries(const VSOP87SeriesSoA *series, int termCount, float T);
+    
+    /*! Compute VSOP87 series and its derivative (per thousand of Julian years) for T, one sincos per term. */
+    static float sumSeriesAndRate(const VSOP87SeriesSoA *series, int termCount, float T, float *rate);
+    
+    /*! Add VSOP87 series for several T (thousands of Julian years from J2000) to sums.
+     *  Count must be a multiple of VSOP87_SOA_LANES. Terms are walked once for all epochs (the
+     *  whole series stays in L1 cache) and cos() is vectorized across epochs. */
+    static void addSeriesForTimes(const VSOP87SeriesSoA *series, int termCount, const float *T, float *sums, int count);
+    
+    /*! Get structure of arrays version of longitude and distance (latitude false) or latitude terms of the Moon. */
+    static const MoonSeriesSoA *moonSeries(bool latitude);
+    
+    /*! Sum terms of the Moon for arguments D, M, M', F in floating degrees (in [0,360[) and eccentricity factor E:
+     *  sum of sine*E^|M|*sin(argument) and cosine*E^|M|*cos(argument). */
+    static void sumMoonSeries(const MoonSeriesSoA *series, const float arguments[4], float E, float *sineSum, float *cosineSum);
+};
+
+#endif
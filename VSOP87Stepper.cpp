@@ -0,0 +1,191 @@
+/*
+ * VSOP87Stepper.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#if ARDUINO
+#include <Arduino.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "VSOP87Stepper.hpp"
+
+VSOP87Stepper::VSOP87Stepper(SolarSystemObjectIndex planet, float T, float dT, int resyncInterval)
+{
+    termCount = 0;
+    A = B = C = NULL;
+    cosArgument = sinArgument = cosStep = sinStep = NULL;
+    
+    // VSOP87 time unit is thousand of Julian years
+    tau0 = T/10.0;
+    dTau = dT/10.0;
+    step = 0;
+    
+    this->resyncInterval = resyncInterval > 0 ? resyncInterval : 1;
+    
+    memset(seriesStart, 0, sizeof(seriesStart));
+    memset(seriesCount, 0, sizeof(seriesCount));
+    
+    VSOP87PlanetSeries planetSeries;
+    if( !Ephemeris::vsop87SeriesForPlanet(planet, &planetSeries) )
+    {
+        return;
+    }
+    
+    // Concatenate every table
+    int count = 0;
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        for(int power=0; power<VSOP87_POWER_COUNT; power++)
+        {
+            seriesStart[variable][power] = count;
+            seriesCount[variable][power] = planetSeries.series[variable][power].count;
+            
+            count += seriesCount[variable][power];
+        }
+    }
+    
+    A           = (double *)malloc(count*sizeof(double));
+    B           = (double *)malloc(count*sizeof(double));
+    C           = (double *)malloc(count*sizeof(double));
+    cosArgument = (double *)malloc(count*sizeof(double));
+    sinArgument = (double *)malloc(count*sizeof(double));
+    cosStep     = (double *)malloc(count*sizeof(double));
+    sinStep     = (double *)malloc(count*sizeof(double));
+    
+    if( !A || !B || !C || !cosArgument || !sinArgument || !cosStep || !sinStep )
+    {
+        return;
+    }
+    
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        for(int power=0; power<VSOP87_POWER_COUNT; power++)
+        {
+            const VSOP87Series *series = &planetSeries.series[variable][power];
+            
+            for(int numCoef=0; numCoef<series->count; numCoef++)
+            {
+                VSOP87Coefficient coef;
+                
+#if ARDUINO
+                // Tables are in flash memory (PROGMEM)
+                memcpy_P(&coef, &series->coefficients[numCoef], sizeof(VSOP87Coefficient));
+#else
+                coef = series->coefficients[numCoef];
+#endif
+                
+                int term = seriesStart[variable][power]+numCoef;
+                
+                // sqrt(A) is stored in VSOP87.h
+                A[term] = (double)coef.A*coef.A;
+                B[term] = coef.B;
+                C[term] = coef.C;
+                
+                // Constant rotation of one step
+                cosStep[term] = cos(C[term]*dTau);
+                sinStep[term] = sin(C[term]*dTau);
+            }
+        }
+    }
+    
+    termCount = count;
+}
+
+VSOP87Stepper::~VSOP87Stepper()
+{
+    free(A);
+    free(B);
+    free(C);
+    free(cosArgument);
+    free(sinArgument);
+    free(cosStep);
+    free(sinStep);
+}
+
+bool VSOP87Stepper::isValid() const
+{
+    return termCount > 0;
+}
+
+float VSOP87Stepper::currentT() const
+{
+    return (tau0 + step*dTau)*10;
+}
+
+void VSOP87Stepper::resync()
+{
+    double tau = tau0 + step*dTau;
+    
+    for(int term=0; term<termCount; term++)
+    {
+        double argument = B[term] + C[term]*tau;
+        
+        cosArgument[term] = cos(argument);
+        sinArgument[term] = sin(argument);
+    }
+}
+
+HeliocentricCoordinates VSOP87Stepper::next()
+{
+    if( !isValid() )
+    {
+        HeliocentricCoordinates coordinates = {NAN, NAN, NAN};
+        return coordinates;
+    }
+    
+    if( step % resyncInterval == 0 )
+    {
+        // Exact evaluation (first step and periodic drift control)
+        resync();
+    }
+    
+    // Sum tables at current time and advance every argument by C*dTau in the same pass:
+    // cos(a+d) = cos(a)cos(d)-sin(a)sin(d), sin(a+d) = sin(a)cos(d)+cos(a)sin(d)
+    float sums[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        for(int power=0; power<VSOP87_POWER_COUNT; power++)
+        {
+            int    start = seriesStart[variable][power];
+            int    end   = start+seriesCount[variable][power];
+            double value = 0;
+            
+            for(int term=start; term<end; term++)
+            {
+                double cosA = cosArgument[term];
+                double sinA = sinArgument[term];
+                
+                value += A[term]*cosA;
+                
+                cosArgument[term] = cosA*cosStep[term] - sinA*sinStep[term];
+                sinArgument[term] = sinA*cosStep[term] + cosA*sinStep[term];
+            }
+            
+            sums[variable][power] = value;
+        }
+    }
+    
+    HeliocentricCoordinates coordinates = Ephemeris::heliocentricCoordinatesForVSOP87Sums(sums, tau0 + step*dTau);
+    
+    step++;
+    
+    return coordinates;
+}
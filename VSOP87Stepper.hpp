@@ -0,0 +1,95 @@
+/*
+ * VSOP87Stepper.hpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VSOP87Stepper_h
+#define VSOP87Stepper_h
+
+#include "Ephemeris.hpp"
+
+// Number of rotation steps between two exact evaluations of every term.
+#ifndef VSOP87_STEPPER_RESYNC_INTERVAL
+#if ARDUINO
+#define VSOP87_STEPPER_RESYNC_INTERVAL 32
+#else
+#define VSOP87_STEPPER_RESYNC_INTERVAL 1024
+#endif
+#endif
+
+/*!
+ * This class computes heliocentric coordinates of a planet on a uniform time grid (T, T+dT, T+2dT...).
+ *
+ * Argument B+C*T of each VSOP87 term advances by the constant C*dT from one step to the next, so
+ * cos/sin of every term are kept and advanced with an exact angle-addition rotation: a step costs
+ * a few multiply-adds per term instead of one cos(). Every resyncInterval steps all terms are
+ * evaluated again from scratch to cap rounding drift.
+ */
+class VSOP87Stepper
+{
+public:
+    
+    /*! Prepare stepping for a planet from T with step dT (Julian centuries from J2000). */
+    VSOP87Stepper(SolarSystemObjectIndex planet, float T, float dT, int resyncInterval = VSOP87_STEPPER_RESYNC_INTERVAL);
+    
+    ~VSOP87Stepper();
+    
+    /*! Return false if planet has no VSOP87 tables or memory is not available. */
+    bool isValid() const;
+    
+    /*! Compute heliocentric coordinates at current time, then advance to next step. */
+    HeliocentricCoordinates next();
+    
+    /*! Current time (Julian centuries from J2000). */
+    float currentT() const;
+    
+private:
+    
+    // Not copyable (owns term buffers)
+    VSOP87Stepper(const VSOP87Stepper &);
+    VSOP87Stepper &operator=(const VSOP87Stepper &);
+    
+    /*! Evaluate cos/sin of every term at current time. */
+    void resync();
+    
+    /*! Number of terms in all tables. */
+    int termCount;
+    
+    /*! First term and number of terms of each table (by variable and power of time). */
+    int seriesStart[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    int seriesCount[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    
+    /*! Terms (A squared back), current cos/sin of argument and rotation of one step. */
+    double *A;
+    double *B;
+    double *C;
+    double *cosArgument;
+    double *sinArgument;
+    double *cosStep;
+    double *sinStep;
+    
+    /*! Start time and step in thousands of Julian years. */
+    double tau0;
+    double dTau;
+    
+    /*! Current step and resync interval. */
+    long step;
+    int  resyncInterval;
+};
+
+#endif
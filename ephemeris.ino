@@ -122,6 +122,8 @@ void printSolarSystemObjects(int day, int month, int year, int hour, int minute,
   Serial.println("_____________________________________");
   printPlanet("Neptune", Neptune, day, month, year, hour, minute, second);
   Serial.println("_____________________________________");
+  printPlanet("Moon",    EarthsMoon, day, month, year, hour, minute, second);
+  Serial.println("_____________________________________");
 }
 
 void printPlanet(char *solarSystemObjectName, SolarSystemObjectIndex index, int day, int month, int year, int hour, int minute, int second )
@@ -0,0 +1,195 @@
+/*
+ * VSOP87FixedHarness.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Compare fixed point and float evaluations of VSOP87 series (host tool).
+ *
+ * Both paths sum the tables compiled in VSOP87.h / VSOP87Fixed.h for the same T, and are compared with
+ * a double precision evaluation of the same terms: differences are arithmetic errors only. Host timings
+ * are measured, AVR cycles are estimated from operation counts per term (see costs below).
+ *
+ * Build from repository root (scalar float path, like Arduino):
+ *   g++ -O2 -I. -DEPHEMERIS_USE_SOA=0 -DEPHEMERIS_FAST_TRIG=0 tools/VSOP87FixedHarness.cpp Ephemeris.cpp Calendar.cpp \
+ *       VSOP87SoA.cpp VSOP87File.cpp VSOP87FixedPoint.cpp -o vsop87fixed
+ *
+ * Usage:
+ *   vsop87fixed [first year] [last year]   (default 1900 2100)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <chrono>
+
+#include "Ephemeris.hpp"
+#include "VSOP87FixedPoint.hpp"
+
+// Estimated AVR cycles (ATmega, avr-gcc and avr-libc) of operations found in the loop over terms
+#define AVR_CYCLES_READ_TERM    60    // memcpy_P of 12 bytes
+#define AVR_CYCLES_FLOAT_ADD    110   // __addsf3
+#define AVR_CYCLES_FLOAT_MUL    150   // __mulsf3
+#define AVR_CYCLES_FLOAT_COS    1800  // cos, argument reduction included
+#define AVR_CYCLES_MUL_32_64    90    // __mulsidi3, with hardware 8x8 multiplier
+#define AVR_CYCLES_INT64_OP     40    // 64 bits addition or shift by a constant
+#define AVR_CYCLES_SINE_LOOKUP  50    // two pgm_read_dword and quadrant tests
+
+// Float term: B + C*t, cos, A*A*cos, sum (see Ephemeris::sumVSOP87Coefs)
+#define AVR_CYCLES_FLOAT_TERM (AVR_CYCLES_READ_TERM + 2*AVR_CYCLES_FLOAT_ADD + 3*AVR_CYCLES_FLOAT_MUL + AVR_CYCLES_FLOAT_COS + AVR_CYCLES_FLOAT_ADD)
+
+// Fixed point term: C*t, interpolation, A*cos, four 64 bits operations (see VSOP87FixedPoint::sumSeries)
+#define AVR_CYCLES_FIXED_TERM (AVR_CYCLES_READ_TERM + 3*AVR_CYCLES_MUL_32_64 + 4*AVR_CYCLES_INT64_OP + AVR_CYCLES_SINE_LOOKUP)
+
+// AVR clock of Arduino Mega
+#define AVR_CLOCK_HZ 16000000.0
+
+static const char *planetNames[Neptune+1] = {"", "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune"};
+
+// Double precision evaluation of VSOP87.h terms
+static HeliocentricCoordinates referenceCoordinates(SolarSystemObjectIndex planet, float T, double *lon)
+{
+    VSOP87PlanetSeries planetSeries;
+    Ephemeris::vsop87SeriesForPlanet(planet, &planetSeries);
+    
+    double tau = (double)T/10;
+    double values[VSOP87_VARIABLE_COUNT];
+    
+    for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+    {
+        values[variable] = 0;
+        
+        for(int power=VSOP87_POWER_COUNT-1; power>=0; power--)
+        {
+            const VSOP87Series *series = &planetSeries.series[variable][power];
+            
+            double sum = 0;
+            for(int numCoef=0; numCoef<series->count; numCoef++)
+            {
+                const VSOP87Coefficient *coef = &series->coefficients[numCoef];
+                sum += (double)coef->A*coef->A*cos((double)coef->B + (double)coef->C*tau);
+            }
+            
+            values[variable] = values[variable]*tau + sum;
+        }
+    }
+    
+    HeliocentricCoordinates coordinates;
+    *lon = fmod(values[0]/100000000.0*180/M_PI, 360);
+    coordinates.lon    = *lon;
+    coordinates.lat    = values[1]/100000000.0*180/M_PI;
+    coordinates.radius = values[2]/100000000.0;
+    
+    return coordinates;
+}
+
+// Differences in arc seconds (longitude wrapped) and AU
+static void accumulateError(HeliocentricCoordinates coordinates, double referenceLon, HeliocentricCoordinates reference,
+                            HeliocentricCoordinates *maxError)
+{
+    double lonError = fmod(coordinates.lon - referenceLon + 540, 360) - 180;
+    
+    maxError->lon    = fmax(maxError->lon,    fabs(lonError)*3600);
+    maxError->lat    = fmax(maxError->lat,    fabs(coordinates.lat-reference.lat)*3600);
+    maxError->radius = fmax(maxError->radius, fabs(coordinates.radius-reference.radius));
+}
+
+int main(int argc, char **argv)
+{
+    int firstYear = argc > 1 ? atoi(argv[1]) : 1900;
+    int lastYear  = argc > 2 ? atoi(argv[2]) : 2100;
+    
+    // Cosine table
+    double cosineError = 0;
+    for(long sample=0; sample<1000000; sample++)
+    {
+        uint32_t phase = (uint32_t)(sample*4294.967296*1.000001);
+        double   exact = cos(phase/4294967296.0*2*M_PI);
+        cosineError = fmax(cosineError, fabs(VSOP87FixedPoint::cosine(phase)/1073741824.0 - exact));
+    }
+    printf("cosine table: max error %.2e\n\n", cosineError);
+    
+    printf("%-8s %5s | %-28s | %-28s | %-19s | %-19s\n", "planet", "terms",
+           "float error lon/lat\" radius", "fixed error lon/lat\" radius", "host ns float/fixed", "AVR ms float/fixed");
+    
+    float firstT = ((firstYear-2000)*365.25)/36525;
+    float lastT  = ((lastYear -2000)*365.25)/36525;
+    
+    for(int planet=Mercury; planet<=Neptune; planet++)
+    {
+        VSOP87PlanetSeries planetSeries;
+        Ephemeris::vsop87SeriesForPlanet((SolarSystemObjectIndex)planet, &planetSeries);
+        
+        int termCount = 0;
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                termCount += planetSeries.series[variable][power].count;
+            }
+        }
+        
+        HeliocentricCoordinates floatError = {0, 0, 0};
+        HeliocentricCoordinates fixedError = {0, 0, 0};
+        
+        // Every 10 days
+        int sampleCount = 0;
+        for(float T=firstT; T<=lastT; T+=10/36525.0, sampleCount++)
+        {
+            double                  referenceLon;
+            HeliocentricCoordinates reference = referenceCoordinates((SolarSystemObjectIndex)planet, T, &referenceLon);
+            
+            accumulateError(Ephemeris::heliocentricCoordinatesForPlanetAndT((SolarSystemObjectIndex)planet, T),
+                            referenceLon, reference, &floatError);
+            accumulateError(VSOP87FixedPoint::heliocentricCoordinatesForPlanetAndT((SolarSystemObjectIndex)planet, T, NULL),
+                            referenceLon, reference, &fixedError);
+        }
+        
+        // Host timings
+        volatile float sink = 0;
+        
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        for(int sample=0; sample<sampleCount; sample++)
+        {
+            sink = sink + Ephemeris::heliocentricCoordinatesForPlanetAndT((SolarSystemObjectIndex)planet, firstT+sample*10/36525.0).lon;
+        }
+        std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+        for(int sample=0; sample<sampleCount; sample++)
+        {
+            sink = sink + VSOP87FixedPoint::heliocentricCoordinatesForPlanetAndT((SolarSystemObjectIndex)planet, firstT+sample*10/36525.0, NULL).lon;
+        }
+        std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        
+        double floatNanoseconds = std::chrono::duration<double, std::nano>(middle-start).count()/sampleCount;
+        double fixedNanoseconds = std::chrono::duration<double, std::nano>(end-middle).count()/sampleCount;
+        
+        printf("%-8s %5d | %6.3f %6.3f %13.2e | %6.3f %6.3f %13.2e | %9.0f %9.0f | %9.1f %9.1f\n",
+               planetNames[planet], termCount,
+               floatError.lon, floatError.lat, floatError.radius,
+               fixedError.lon, fixedError.lat, fixedError.radius,
+               floatNanoseconds, fixedNanoseconds,
+               termCount*(double)AVR_CYCLES_FLOAT_TERM/AVR_CLOCK_HZ*1000,
+               termCount*(double)AVR_CYCLES_FIXED_TERM/AVR_CLOCK_HZ*1000);
+    }
+    
+    printf("\nAVR estimate: %d cycles per float term, %d cycles per fixed point term (operation counts, see source)\n",
+           AVR_CYCLES_FLOAT_TERM, AVR_CYCLES_FIXED_TERM);
+    
+    return 0;
+}
@@ -0,0 +1,819 @@
+/*
+ * VSOP87Generator.cpp
+ *
+ * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)
+ */
+/*
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Generate VSOP87 coefficient tables (host tool).
+ *
+ * Input is the original VSOP87D distribution (VSOP87D.mer, VSOP87D.ven ... VSOP87D.nep: heliocentric
+ * spherical variables, equinox of date, as used by Ephemeris), or tables compiled in VSOP87.h when no
+ * input file is given. Output is a header in VSOP87.h form and/or a binary file for
+ * Ephemeris::loadVSOP87File (see VSOP87File.hpp). Planets without input file are reported, and headers
+ * (which replace VSOP87.h) are refused unless every planet is given.
+ *
+ * Build from repository root:
+ *   g++ -O2 -I. tools/VSOP87Generator.cpp Ephemeris.cpp Calendar.cpp VSOP87SoA.cpp VSOP87File.cpp -o vsop87gen
+ *
+ * Usage:
+ *   vsop87gen [-t threshold] [-p float|double] [-l soa|aos] [-b file.bin] [-h file.h] [-f file.h] [VSOP87D.xxx ...]
+ *
+ *   -t  drop terms whose amplitude is below threshold (radians or AU, default 0 keeps every term)
+ *   -p  precision of binary file (default float)
+ *   -l  layout of binary file: structure of arrays (default, zero copy SIMD) or A,B,C triplets
+ *   -b  write binary file
+ *   -h  write header: float tables storing sqrt(A*1e8) like VSOP87.h, limited to tables known by
+ *       Ephemeris.cpp (other tables of complete series need the binary file)
+ *   -f  write fixed point header like VSOP87Fixed.h (same tables, see VSOP87FixedPoint.hpp)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Ephemeris.hpp"
+#include "VSOP87File.hpp"
+
+/*! This structure describes one term of a table (A in radians or AU, B in radians, C in radians per thousand of Julian years). */
+struct Term
+{
+    double A;
+    double B;
+    double C;
+};
+
+// Tables by planet, variable (L,B,R) and power of time
+typedef std::vector<Term> Table;
+static Table tables[VSOP87_FILE_PLANET_COUNT][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+
+// Planet names (VSOP87 headers and VSOP87.h table names)
+static const char *upstreamNames[VSOP87_FILE_PLANET_COUNT] = {"", "MERCURY", "VENUS", "EARTH", "MARS", "JUPITER", "SATURN", "URANUS", "NEPTUNE"};
+static const char *tableNames[VSOP87_FILE_PLANET_COUNT]    = {"", "Mercury", "Venus", "Earth", "Mars", "Jupiter", "Saturn", "Uranus", "Neptune"};
+static const char  variableNames[VSOP87_VARIABLE_COUNT]    = {'L', 'B', 'R'};
+
+static bool byDecreasingAmplitude(const Term &first, const Term &second)
+{
+    return first.A > second.A;
+}
+
+// Read one VSOP87D file (several tables of one planet)
+static bool readUpstreamFile(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if( file == NULL )
+    {
+        fprintf(stderr, "%s: can not open file\n", path);
+        return false;
+    }
+    
+    char   line[512];
+    Table *table     = NULL;
+    int    remaining = 0;
+    int    lineCount = 0;
+    
+    while( fgets(line, sizeof(line), file) )
+    {
+        lineCount++;
+        
+        const char *version = strstr(line, "VSOP87 VERSION");
+        if( version )
+        {
+            // " VSOP87 VERSION D4    MERCURY   VARIABLE 1 (LBR)       *T**0   1583 TERMS ..."
+            char versionName[8], planetName[16];
+            int  variable, power, count;
+            
+            const char *variableField = strstr(line, "VARIABLE");
+            const char *powerField    = strstr(line, "*T**");
+            
+            if( sscanf(version, "VSOP87 VERSION %7s %15s", versionName, planetName) != 2 ||
+                variableField == NULL || sscanf(variableField, "VARIABLE %d", &variable) != 1 ||
+                powerField    == NULL || sscanf(powerField, "*T**%d %d", &power, &count) != 2 )
+            {
+                fprintf(stderr, "%s:%d: malformed header\n", path, lineCount);
+                fclose(file);
+                return false;
+            }
+            
+            if( versionName[0] != 'D' )
+            {
+                fprintf(stderr, "%s: version %s is not supported (heliocentric spherical of date, VSOP87D, expected)\n", path, versionName);
+                fclose(file);
+                return false;
+            }
+            
+            int planet = 0;
+            for(int index=1; index<VSOP87_FILE_PLANET_COUNT; index++)
+            {
+                if( strcmp(planetName, upstreamNames[index]) == 0 )
+                {
+                    planet = index;
+                }
+            }
+            
+            if( planet == 0 || variable < 1 || variable > VSOP87_VARIABLE_COUNT || power < 0 || power >= VSOP87_POWER_COUNT )
+            {
+                fprintf(stderr, "%s:%d: unknown table %s %d %d\n", path, lineCount, planetName, variable, power);
+                fclose(file);
+                return false;
+            }
+            
+            table     = &tables[planet][variable-1][power];
+            remaining = count;
+            table->clear();
+            continue;
+        }
+        
+        if( remaining == 0 )
+        {
+            continue;
+        }
+        
+        // Term: indices, S, K, A, B, C (A, B and C are the last three fields)
+        std::vector<double> fields;
+        for(char *field=strtok(line, " \t\r\n"); field; field=strtok(NULL, " \t\r\n"))
+        {
+            fields.push_back(atof(field));
+        }
+        
+        if( fields.size() < 3 )
+        {
+            fprintf(stderr, "%s:%d: malformed term\n", path, lineCount);
+            fclose(file);
+            return false;
+        }
+        
+        Term term;
+        term.A = fields[fields.size()-3];
+        term.B = fields[fields.size()-2];
+        term.C = fields[fields.size()-1];
+        table->push_back(term);
+        
+        remaining--;
+    }
+    
+    fclose(file);
+    
+    if( remaining != 0 )
+    {
+        fprintf(stderr, "%s: truncated file\n", path);
+        return false;
+    }
+    
+    return true;
+}
+
+// Read tables compiled in VSOP87.h
+static void readCompiledTables()
+{
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        VSOP87PlanetSeries planetSeries;
+        Ephemeris::vsop87SeriesForPlanet((SolarSystemObjectIndex)planet, &planetSeries);
+        
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const VSOP87Series *series = &planetSeries.series[variable][power];
+                
+                for(int numCoef=0; numCoef<series->count; numCoef++)
+                {
+                    // sqrt(A*1e8) is stored in VSOP87.h
+                    Term term;
+                    term.A = (double)series->coefficients[numCoef].A*series->coefficients[numCoef].A/100000000.0;
+                    term.B = series->coefficients[numCoef].B;
+                    term.C = series->coefficients[numCoef].C;
+                    tables[planet][variable][power].push_back(term);
+                }
+            }
+        }
+    }
+}
+
+// Sort by decreasing amplitude (truncation relies on it) and apply threshold
+static int truncateTables(double threshold)
+{
+    int termCount = 0;
+    
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                Table *table = &tables[planet][variable][power];
+                std::stable_sort(table->begin(), table->end(), byDecreasingAmplitude);
+                
+                while( !table->empty() && table->back().A < threshold )
+                {
+                    table->pop_back();
+                }
+                
+                termCount += table->size();
+            }
+        }
+    }
+    
+    return termCount;
+}
+
+static void appendValue(std::vector<char> *payload, size_t at, double value, bool useDouble)
+{
+    if( useDouble )
+    {
+        memcpy(&(*payload)[at], &value, sizeof(double));
+    }
+    else
+    {
+        float floatValue = value;
+        memcpy(&(*payload)[at], &floatValue, sizeof(float));
+    }
+}
+
+// Write binary file (see VSOP87File.hpp)
+static bool writeBinaryFile(const char *path, bool useDouble, bool aos)
+{
+    VSOP87FileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, VSOP87_FILE_MAGIC, sizeof(header.magic));
+    header.version = VSOP87_FILE_VERSION;
+    header.flags   = (useDouble ? VSOP87_FILE_DOUBLE : 0) | (aos ? VSOP87_FILE_AOS : 0);
+    
+    size_t valueSize   = useDouble ? sizeof(double) : sizeof(float);
+    size_t payloadBase = (sizeof(header)+VSOP87_FILE_ALIGNMENT-1)/VSOP87_FILE_ALIGNMENT*VSOP87_FILE_ALIGNMENT;
+    
+    // Tables of a planet are contiguous
+    std::vector<char> payload;
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const Table *table = &tables[planet][variable][power];
+                if( table->empty() )
+                {
+                    continue;
+                }
+                
+                VSOP87FileSeries *series = &header.series[planet][variable][power];
+                series->count       = table->size();
+                series->paddedCount = (table->size()+VSOP87_FILE_PADDING-1)/VSOP87_FILE_PADDING*VSOP87_FILE_PADDING;
+                series->offset      = payloadBase+payload.size();
+                
+                // Null padding terms are zero bytes
+                size_t tableSize;
+                if( aos )
+                {
+                    series->stride = 0;
+                    tableSize = 3*series->paddedCount*valueSize;
+                }
+                else
+                {
+                    series->stride = (series->paddedCount*valueSize+VSOP87_FILE_ALIGNMENT-1)/VSOP87_FILE_ALIGNMENT*VSOP87_FILE_ALIGNMENT;
+                    tableSize = 3*series->stride;
+                }
+                
+                size_t start = payload.size();
+                payload.resize(start+(tableSize+VSOP87_FILE_ALIGNMENT-1)/VSOP87_FILE_ALIGNMENT*VSOP87_FILE_ALIGNMENT, 0);
+                
+                for(size_t numTerm=0; numTerm<table->size(); numTerm++)
+                {
+                    const Term &term = (*table)[numTerm];
+                    
+                    // Amplitude in 1e-8 radian or AU, already squared (unlike VSOP87.h)
+                    double values[3] = {term.A*100000000.0, term.B, term.C};
+                    
+                    for(int value=0; value<3; value++)
+                    {
+                        size_t at = aos ? start+(3*numTerm+value)*valueSize : start+value*series->stride+numTerm*valueSize;
+                        appendValue(&payload, at, values[value], useDouble);
+                    }
+                }
+            }
+        }
+    }
+    
+    header.fileSize = payloadBase+payload.size();
+    
+    FILE *file = fopen(path, "wb");
+    if( file == NULL )
+    {
+        fprintf(stderr, "%s: can not create file\n", path);
+        return false;
+    }
+    
+    std::vector<char> headerBlock(payloadBase, 0);
+    memcpy(&headerBlock[0], &header, sizeof(header));
+    
+    bool written = fwrite(&headerBlock[0], 1, headerBlock.size(), file) == headerBlock.size() &&
+                   fwrite(&payload[0], 1, payload.size(), file) == payload.size();
+    
+    if( fclose(file) != 0 || !written )
+    {
+        fprintf(stderr, "%s: write error\n", path);
+        return false;
+    }
+    
+    return true;
+}
+
+// Beginning of VSOP87.h (types used by tables)
+static const char *headerPrologue =
+"/*\n"
+" * VSOP87.h\n"
+" *\n"
+" * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)\n"
+" *\n"
+" * Generated by tools/VSOP87Generator.cpp (%s, threshold %g).\n"
+" */\n"
+"/*\n"
+" * This program is free software: you can redistribute it and/or modify\n"
+" * it under the terms of the GNU General Public License as published by\n"
+" * the Free Software Foundation, either version 3 of the License, or\n"
+" * (at your option) any later version.\n"
+" *\n"
+" * This program is distributed in the hope that it will be useful,\n"
+" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+" * GNU General Public License for more details.\n"
+" *\n"
+" * You should have received a copy of the GNU General Public License\n"
+" * along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+" */\n"
+"\n"
+"#ifndef VSOP87_h\n"
+"#define VSOP87_h\n"
+"\n"
+"#if ARDUINO\n"
+"#define CONST const PROGMEM\n"
+"#else\n"
+"#define CONST const\n"
+"#endif\n"
+"\n"
+"struct VSOP87Coefficient\n"
+"{\n"
+"    float A;\n"
+"    float B;\n"
+"    float C;\n"
+"};\n"
+"\n"
+"// VSOP87 variables (longitude, latitude, radius) and powers of time per variable\n"
+"#define VSOP87_VARIABLE_COUNT 3\n"
+"#define VSOP87_POWER_COUNT    6\n"
+"\n"
+"/*! This structure describes one VSOP87 table. */\n"
+"struct VSOP87Series\n"
+"{\n"
+"    /*! Terms of the table (NULL if table does not exist). */\n"
+"    const VSOP87Coefficient *coefficients;\n"
+"    \n"
+"    /*! Number of terms. */\n"
+"    int count;\n"
+"};\n"
+"\n"
+"/*! This structure describes VSOP87 tables of a planet, indexed by variable (L,B,R) and power of time. */\n"
+"struct VSOP87PlanetSeries\n"
+"{\n"
+"    VSOP87Series series[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];\n"
+"};\n"
+"\n";
+
+// Write header in VSOP87.h form
+static bool writeHeaderFile(const char *path, const char *source, double threshold)
+{
+    FILE *file = fopen(path, "w");
+    if( file == NULL )
+    {
+        fprintf(stderr, "%s: can not create file\n", path);
+        return false;
+    }
+    
+    fprintf(file, headerPrologue, source, threshold);
+    
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        fprintf(file, "\n////////////////////////////////////////////////////////////\n");
+        fprintf(file, "//\n//         Tables of VSOP87 terms for %s.\n//\n", tableNames[planet]);
+        
+        // Ephemeris.cpp refers to the tables of VSOP87.h, no more no less
+        VSOP87PlanetSeries planetSeries;
+        Ephemeris::vsop87SeriesForPlanet((SolarSystemObjectIndex)planet, &planetSeries);
+        
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const Table *table = &tables[planet][variable][power];
+                
+                if( planetSeries.series[variable][power].count == 0 )
+                {
+                    if( !table->empty() )
+                    {
+                        fprintf(stderr, "warning: %c%d%s (%d terms) is not used by Ephemeris.cpp, only written to binary file\n",
+                                variableNames[variable], power, tableNames[planet], (int)table->size());
+                    }
+                    continue;
+                }
+                
+                fprintf(file, "\nCONST VSOP87Coefficient %c%d%sCoefficients[] =\n{\n", variableNames[variable], power, tableNames[planet]);
+                    
+                if( table->empty() )
+                {
+                    // Every term is below threshold: one null term keeps the table
+                    fprintf(file, "    {0.000000, 0.000000, 0.000000}\n");
+                }
+                    
+                for(size_t numTerm=0; numTerm<table->size(); numTerm++)
+                {
+                    const Term &term = (*table)[numTerm];
+                        
+                    // sqrt(A*1e8) avoids out of range issues with single precision
+                    fprintf(file, "    {%f, %f, %f}%s\n", sqrt(term.A*100000000.0), term.B, term.C,
+                            numTerm+1 < table->size() ? "," : "");
+                }
+                    
+                fprintf(file, "};\n");
+            }
+        }
+    }
+    
+    fprintf(file, "\n#endif\n");
+    
+    if( fclose(file) != 0 )
+    {
+        fprintf(stderr, "%s: write error\n", path);
+        return false;
+    }
+    
+    return true;
+}
+
+// Beginning of VSOP87Fixed.h (types and sine table used by tables)
+static const char *fixedHeaderPrologue =
+"/*\n"
+" * VSOP87Fixed.h\n"
+" *\n"
+" * Copyright (c) 2017 by Sebastien MARCHAND (Web:www.marscaper.com, Email:sebastien@marscaper.com)\n"
+" *\n"
+" * Generated by tools/VSOP87Generator.cpp (%s, threshold %g).\n"
+" */\n"
+"/*\n"
+" * This program is free software: you can redistribute it and/or modify\n"
+" * it under the terms of the GNU General Public License as published by\n"
+" * the Free Software Foundation, either version 3 of the License, or\n"
+" * (at your option) any later version.\n"
+" *\n"
+" * This program is distributed in the hope that it will be useful,\n"
+" * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+" * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+" * GNU General Public License for more details.\n"
+" *\n"
+" * You should have received a copy of the GNU General Public License\n"
+" * along with this program.  If not, see <http://www.gnu.org/licenses/>.\n"
+" */\n"
+"\n"
+"#ifndef VSOP87Fixed_h\n"
+"#define VSOP87Fixed_h\n"
+"\n"
+"#include <stdint.h>\n"
+"\n"
+"#include \"VSOP87.h\"\n"
+"\n"
+"// Fractional bits of frequencies (turns per thousand of Julian years)\n"
+"#define VSOP87_FIXED_FREQUENCY_BITS %d\n"
+"\n"
+"// Quarter wave sine table: 2^bits intervals, values in Q30\n"
+"#define VSOP87_FIXED_SINE_BITS %d\n"
+"\n"
+"/*! This structure describes one VSOP87 term in fixed point: A*cos(B+C*t). */\n"
+"struct VSOP87FixedCoefficient\n"
+"{\n"
+"    /*! Amplitude in 1e-8 radian or AU, divided by 2^shift of its table. */\n"
+"    uint32_t A;\n"
+"    \n"
+"    /*! Phase in turns (Q32, wraps around). */\n"
+"    uint32_t B;\n"
+"    \n"
+"    /*! Frequency in turns per thousand of Julian years (VSOP87_FIXED_FREQUENCY_BITS fractional bits). */\n"
+"    int32_t C;\n"
+"};\n"
+"\n"
+"/*! This structure describes one VSOP87 table in fixed point. */\n"
+"struct VSOP87FixedSeries\n"
+"{\n"
+"    /*! Terms of the table (NULL if table does not exist). */\n"
+"    const VSOP87FixedCoefficient *coefficients;\n"
+"    \n"
+"    /*! Number of terms. */\n"
+"    int count;\n"
+"    \n"
+"    /*! Amplitude scale of the table (largest amplitudes of first power of time do not fit 32 bits). */\n"
+"    int shift;\n"
+"};\n"
+"\n"
+"/*! This structure describes fixed point tables of a planet, indexed by variable (L,B,R) and power of time. */\n"
+"struct VSOP87FixedPlanetSeries\n"
+"{\n"
+"    VSOP87FixedSeries series[VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];\n"
+"};\n"
+"\n";
+
+// Fixed point formats written to VSOP87Fixed.h
+#define FIXED_FREQUENCY_BITS 15
+#define FIXED_SINE_BITS      10
+
+// Write header in VSOP87Fixed.h form (tables of VSOP87.h in integers)
+static bool writeFixedHeaderFile(const char *path, const char *source, double threshold)
+{
+    FILE *file = fopen(path, "w");
+    if( file == NULL )
+    {
+        fprintf(stderr, "%s: can not create file\n", path);
+        return false;
+    }
+    
+    fprintf(file, fixedHeaderPrologue, source, threshold, FIXED_FREQUENCY_BITS, FIXED_SINE_BITS);
+    
+    // Quarter wave plus two entries: interpolation reads one entry past a quarter turn
+    int sineCount = (1<<FIXED_SINE_BITS)+2;
+    fprintf(file, "CONST int32_t VSOP87FixedSine[(1<<VSOP87_FIXED_SINE_BITS)+2] =\n{");
+    for(int entry=0; entry<sineCount; entry++)
+    {
+        double value = floor(sin(M_PI/2*entry/(1<<FIXED_SINE_BITS))*1073741824.0+0.5);
+        fprintf(file, "%s%s%ld", entry > 0 ? "," : "", entry%8 == 0 ? "\n    " : " ", (long)value);
+    }
+    fprintf(file, "\n};\n");
+    
+    int shifts[VSOP87_FILE_PLANET_COUNT][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    bool used[VSOP87_FILE_PLANET_COUNT][VSOP87_VARIABLE_COUNT][VSOP87_POWER_COUNT];
+    
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        fprintf(file, "\n////////////////////////////////////////////////////////////\n");
+        fprintf(file, "//\n//         Fixed point tables of VSOP87 terms for %s.\n//\n", tableNames[planet]);
+        
+        // Same tables as VSOP87.h (truncation term counts apply to both)
+        VSOP87PlanetSeries planetSeries;
+        Ephemeris::vsop87SeriesForPlanet((SolarSystemObjectIndex)planet, &planetSeries);
+        
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                const Table *table = &tables[planet][variable][power];
+                
+                used[planet][variable][power] = planetSeries.series[variable][power].count > 0;
+                if( !used[planet][variable][power] )
+                {
+                    continue;
+                }
+                
+                // Smallest amplitude scale fitting 32 bits
+                double maxAmplitude = 0;
+                for(size_t numTerm=0; numTerm<table->size(); numTerm++)
+                {
+                    maxAmplitude = fmax(maxAmplitude, (*table)[numTerm].A*100000000.0);
+                }
+                
+                int shift = 0;
+                while( floor(maxAmplitude/ldexp(1.0, shift)+0.5) > 4294967295.0 )
+                {
+                    shift++;
+                }
+                shifts[planet][variable][power] = shift;
+                
+                fprintf(file, "\nCONST VSOP87FixedCoefficient %c%d%sFixedCoefficients[] =\n{\n", variableNames[variable], power, tableNames[planet]);
+                    
+                if( table->empty() )
+                {
+                    // Every term is below threshold: one null term keeps the table
+                    fprintf(file, "    {0, 0, 0}\n");
+                }
+                    
+                for(size_t numTerm=0; numTerm<table->size(); numTerm++)
+                {
+                    const Term &term = (*table)[numTerm];
+                        
+                    double turns     = term.B/(2*M_PI);
+                    double frequency = floor(term.C/(2*M_PI)*ldexp(1.0, FIXED_FREQUENCY_BITS)+0.5);
+                    if( fabs(frequency) > 2147483647.0 )
+                    {
+                        fprintf(stderr, "%c%d%s: frequency %g out of fixed point range\n", variableNames[variable], power, tableNames[planet], term.C);
+                        fclose(file);
+                        return false;
+                    }
+                        
+                    uint32_t A = (uint32_t)floor(term.A*100000000.0/ldexp(1.0, shift)+0.5);
+                    uint32_t B = (uint32_t)fmod(floor((turns-floor(turns))*4294967296.0+0.5), 4294967296.0);
+                    int32_t  C = (int32_t)frequency;
+                        
+                    fprintf(file, "    {%luUL, %luUL, %ldL}%s\n", (unsigned long)A, (unsigned long)B, (long)C,
+                            numTerm+1 < table->size() ? "," : "");
+                }
+                    
+                fprintf(file, "};\n");
+            }
+        }
+    }
+    
+    // Descriptors of every planet (Sun has no tables)
+    fprintf(file, "\n#if ARDUINO\n#define VSOP87_FIXED_DESCRIPTOR const PROGMEM\n#else\n#define VSOP87_FIXED_DESCRIPTOR const\n#endif\n");
+    fprintf(file, "\n#define VSOP87_FIXED_SERIES(table, shift) {table, sizeof(table)/sizeof(VSOP87FixedCoefficient), shift}\n");
+    fprintf(file, "#define VSOP87_FIXED_NO_SERIES           {NULL, 0, 0}\n");
+    fprintf(file, "\nstatic VSOP87_FIXED_DESCRIPTOR VSOP87FixedPlanetSeries vsop87FixedPlanetSeries[] =\n{\n");
+        
+    for(int planet=0; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        fprintf(file, "    // %s\n    {{\n", planet == 0 ? "Sun" : tableNames[planet]);
+            
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            fprintf(file, "        {");
+                    
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                if( planet > 0 && used[planet][variable][power] )
+                {
+                    fprintf(file, "VSOP87_FIXED_SERIES(%c%d%sFixedCoefficients, %d)", variableNames[variable], power, tableNames[planet],
+                            shifts[planet][variable][power]);
+                }
+                else
+                {
+                    fprintf(file, "VSOP87_FIXED_NO_SERIES");
+                }
+                        
+                fprintf(file, "%s", power+1 < VSOP87_POWER_COUNT ? ", " : "");
+            }
+                    
+            fprintf(file, "}%s\n", variable+1 < VSOP87_VARIABLE_COUNT ? "," : "");
+        }
+            
+        fprintf(file, "    }}%s\n", planet+1 < VSOP87_FILE_PLANET_COUNT ? "," : "");
+    }
+
+    fprintf(file, "};\n\n#endif\n");
+
+    if( fclose(file) != 0 )
+    {
+        fprintf(stderr, "%s: write error\n", path);
+        return false;
+    }
+
+    return true;
+}
+
+static void usage()
+{
+    fprintf(stderr, "usage: vsop87gen [-t threshold] [-p float|double] [-l soa|aos] [-b file.bin] [-h file.h] [-f file.h] [VSOP87D.xxx ...]\n");
+}
+
+int main(int argc, char **argv)
+{
+    double      threshold  = 0;
+    bool        useDouble  = false;
+    bool        aos        = false;
+    const char *binaryPath = NULL;
+    const char *headerPath = NULL;
+    const char *fixedPath  = NULL;
+    
+    std::vector<const char *> inputs;
+    
+    for(int arg=1; arg<argc; arg++)
+    {
+        std::string option = argv[arg];
+        bool hasValue = arg+1 < argc;
+        
+        if( option == "-t" && hasValue )
+        {
+            threshold = atof(argv[++arg]);
+        }
+        else if( option == "-p" && hasValue )
+        {
+            std::string precision = argv[++arg];
+            if( precision != "float" && precision != "double" )
+            {
+                usage();
+                return 1;
+            }
+            useDouble = precision == "double";
+        }
+        else if( option == "-l" && hasValue )
+        {
+            std::string layout = argv[++arg];
+            if( layout != "soa" && layout != "aos" )
+            {
+                usage();
+                return 1;
+            }
+            aos = layout == "aos";
+        }
+        else if( option == "-b" && hasValue )
+        {
+            binaryPath = argv[++arg];
+        }
+        else if( option == "-h" && hasValue )
+        {
+            headerPath = argv[++arg];
+        }
+        else if( option == "-f" && hasValue )
+        {
+            fixedPath = argv[++arg];
+        }
+        else if( option[0] == '-' )
+        {
+            usage();
+            return 1;
+        }
+        else
+        {
+            inputs.push_back(argv[arg]);
+        }
+    }
+    
+    if( binaryPath == NULL && headerPath == NULL && fixedPath == NULL )
+    {
+        usage();
+        return 1;
+    }
+    
+    if( inputs.empty() )
+    {
+        readCompiledTables();
+    }
+    
+    for(size_t input=0; input<inputs.size(); input++)
+    {
+        if( !readUpstreamFile(inputs[input]) )
+        {
+            return 1;
+        }
+    }
+    
+    // A planet without terms would silently give zeros: headers replace VSOP87.h, so every planet is needed
+    bool complete = true;
+    for(int planet=1; planet<VSOP87_FILE_PLANET_COUNT; planet++)
+    {
+        bool found = false;
+        for(int variable=0; variable<VSOP87_VARIABLE_COUNT; variable++)
+        {
+            for(int power=0; power<VSOP87_POWER_COUNT; power++)
+            {
+                found = found || !tables[planet][variable][power].empty();
+            }
+        }
+        
+        if( !found )
+        {
+            fprintf(stderr, "%s: no VSOP87D file given for this planet\n", tableNames[planet]);
+            complete = false;
+        }
+    }
+    
+    if( !complete && (headerPath || fixedPath) )
+    {
+        fprintf(stderr, "headers need every planet (-h and -f refused)\n");
+        return 1;
+    }
+    
+    int termCount = truncateTables(threshold);
+    fprintf(stderr, "%d terms kept\n", termCount);
+    
+    if( binaryPath && !writeBinaryFile(binaryPath, useDouble, aos) )
+    {
+        return 1;
+    }
+    
+    if( headerPath && !writeHeaderFile(headerPath, inputs.empty() ? "from VSOP87.h" : "from VSOP87D files", threshold) )
+    {
+        return 1;
+    }
+    
+    if( fixedPath && !writeFixedHeaderFile(fixedPath, inputs.empty() ? "from VSOP87.h" : "from VSOP87D files", threshold) )
+    {
+        return 1;
+    }
+    
+    return 0;
+}